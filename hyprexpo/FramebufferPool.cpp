@@ -0,0 +1,133 @@
+#include "FramebufferPool.hpp"
+
+#include <algorithm>
+
+#include <hyprland/src/render/Renderer.hpp>
+#include <hyprland/src/render/OpenGL.hpp>
+#include <hyprland/src/managers/eventLoop/EventLoopManager.hpp>
+#include <hyprland/src/managers/eventLoop/EventLoopTimer.hpp>
+
+static size_t fbBytes(const Vector2D& size) {
+    // every format we render tiles in is 32 bits per pixel
+    return (size_t)size.x * (size_t)size.y * 4;
+}
+
+CFramebufferPool::CFramebufferPool() {
+    m_idleTimer = makeShared<CEventLoopTimer>(std::nullopt, [this](SP<CEventLoopTimer> self, void* data) { releaseIdle(); }, nullptr);
+    g_pEventLoopManager->addTimer(m_idleTimer);
+}
+
+CFramebufferPool::~CFramebufferPool() {
+    if (m_idleTimer)
+        g_pEventLoopManager->removeTimer(m_idleTimer);
+
+    clear();
+}
+
+SP<CFramebuffer> CFramebufferPool::acquire(const Vector2D& size, uint32_t drmFormat) {
+    // most recently used match first, it's the most likely to still be hot
+    for (size_t i = m_pooled.size(); i > 0; --i) {
+        auto& e = m_pooled[i - 1];
+        if (e.size != size || e.drmFormat != drmFormat)
+            continue;
+
+        auto entry = e;
+        m_pooled.erase(m_pooled.begin() + (i - 1));
+
+        m_stats.hits++;
+        m_stats.bytesPooled -= fbBytes(size);
+        m_stats.bytesInUse += fbBytes(size);
+
+        m_inUse.emplace_back(entry);
+        return entry.fb;
+    }
+
+    m_stats.misses++;
+
+    auto fb = makeShared<CFramebuffer>();
+    fb->alloc(size.x, size.y, drmFormat);
+
+    m_stats.bytesInUse += fbBytes(size);
+    m_inUse.emplace_back(SPoolEntry{fb, size, drmFormat, Time::steadyNow()});
+
+    return fb;
+}
+
+void CFramebufferPool::release(SP<CFramebuffer> fb) {
+    static auto* const* PMAXENTRIES = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:fb_pool_size")->getDataStaticPtr();
+
+    if (!fb)
+        return;
+
+    auto it = std::ranges::find_if(m_inUse, [&fb](const auto& e) { return e.fb == fb; });
+    if (it == m_inUse.end())
+        return;
+
+    auto entry     = *it;
+    entry.lastUsed = Time::steadyNow();
+    m_inUse.erase(it);
+
+    m_stats.bytesInUse -= fbBytes(entry.size);
+    m_stats.bytesPooled += fbBytes(entry.size);
+
+    m_pooled.emplace_back(entry);
+
+    trim(std::max(**PMAXENTRIES, (Hyprlang::INT)0));
+
+    scheduleIdleRelease();
+}
+
+void CFramebufferPool::clear() {
+    if (m_pooled.empty())
+        return;
+
+    g_pHyprRenderer->makeEGLCurrent();
+
+    for (auto& e : m_pooled) {
+        e.fb->release();
+    }
+
+    m_stats.evictions += m_pooled.size();
+    m_stats.bytesPooled = 0;
+    m_pooled.clear();
+}
+
+void CFramebufferPool::evict(size_t idx) {
+    g_pHyprRenderer->makeEGLCurrent();
+
+    m_pooled[idx].fb->release();
+
+    m_stats.evictions++;
+    m_stats.bytesPooled -= fbBytes(m_pooled[idx].size);
+
+    m_pooled.erase(m_pooled.begin() + idx);
+}
+
+void CFramebufferPool::trim(size_t maxEntries) {
+    while (m_pooled.size() > maxEntries) {
+        evict(0);
+    }
+}
+
+void CFramebufferPool::releaseIdle() {
+    static auto* const* PIDLEMS = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:fb_pool_idle_release_ms")->getDataStaticPtr();
+
+    const auto NOW = Time::steadyNow();
+
+    while (!m_pooled.empty() && NOW - m_pooled.front().lastUsed >= std::chrono::milliseconds(**PIDLEMS)) {
+        evict(0);
+    }
+
+    if (!m_pooled.empty())
+        scheduleIdleRelease();
+}
+
+void CFramebufferPool::scheduleIdleRelease() {
+    static auto* const* PIDLEMS = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:fb_pool_idle_release_ms")->getDataStaticPtr();
+
+    if (m_pooled.empty())
+        return;
+
+    const auto DEADLINE = m_pooled.front().lastUsed + std::chrono::milliseconds(**PIDLEMS);
+    m_idleTimer->updateTimeout(std::chrono::duration_cast<Time::steady_dur>(std::max(DEADLINE - Time::steadyNow(), Time::steady_dur::zero())));
+}
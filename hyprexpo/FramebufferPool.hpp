@@ -0,0 +1,53 @@
+#pragma once
+
+#define WLR_USE_UNSTABLE
+
+#include "globals.hpp"
+#include <hyprland/src/render/Framebuffer.hpp>
+#include <hyprland/src/helpers/time/Time.hpp>
+#include <vector>
+
+class CEventLoopTimer;
+
+// Keeps tile framebuffers alive between overview sessions, so toggling the
+// overview doesn't hit the driver with a burst of allocations every time.
+class CFramebufferPool {
+  public:
+    CFramebufferPool();
+    ~CFramebufferPool();
+
+    // returns an allocated fb of the given size and format, pooled if possible
+    SP<CFramebuffer> acquire(const Vector2D& size, uint32_t drmFormat);
+    // hands an fb back to the pool. It stays allocated until evicted.
+    void             release(SP<CFramebuffer> fb);
+    // frees every pooled (not in use) fb
+    void             clear();
+
+    struct {
+        uint64_t hits        = 0;
+        uint64_t misses      = 0;
+        uint64_t evictions   = 0;
+        size_t   bytesPooled = 0;
+        size_t   bytesInUse  = 0;
+    } m_stats;
+
+  private:
+    struct SPoolEntry {
+        SP<CFramebuffer> fb;
+        Vector2D         size;
+        uint32_t         drmFormat = 0;
+        Time::steady_tp  lastUsed;
+    };
+
+    void                    evict(size_t idx);
+    void                    trim(size_t maxEntries);
+    void                    releaseIdle();
+    void                    scheduleIdleRelease();
+
+    std::vector<SPoolEntry> m_pooled; // least recently used first
+    std::vector<SPoolEntry> m_inUse;
+
+    SP<CEventLoopTimer>     m_idleTimer;
+};
+
+inline UP<CFramebufferPool> g_pFramebufferPool;
@@ -0,0 +1,70 @@
+#include "OverviewLayout.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+int SOverviewGrid::maxScrollRow() const {
+    const int ROWS = (tiles + columns - 1) / columns;
+    return std::max(ROWS - columns, 0);
+}
+
+int SOverviewGrid::scrollRowFor(int id) const {
+    return std::clamp(id / columns - columns / 2, 0, maxScrollRow());
+}
+
+bool SOverviewGrid::isVisible(int id) const {
+    const int ROW = id / columns;
+    return ROW >= scrollRow && ROW < scrollRow + columns;
+}
+
+bool SOverviewGrid::isResident(int id) const {
+    const int ROW = id / columns;
+    return ROW >= scrollRow - 1 && ROW <= scrollRow + columns;
+}
+
+Vector2D SOverviewGrid::tileCoords(int id) const {
+    return Vector2D{id % columns, id / columns - scrollRow};
+}
+
+int SOverviewGrid::tileDistance(int a, int b) const {
+    return std::max(std::abs(a % columns - b % columns), std::abs(a / columns - b / columns));
+}
+
+CBox SOverviewGrid::tileBox(int id, const Vector2D& gridSize, double gap) const {
+    const Vector2D TILESIZE = (gridSize - Vector2D{gap, gap} * (columns - 1)) / columns;
+    const int      X = id % columns, Y = id / columns - scrollRow;
+
+    return {X * TILESIZE.x + X * gap, Y * TILESIZE.y + Y * gap, TILESIZE.x, TILESIZE.y};
+}
+
+int SOverviewGrid::tileAt(const Vector2D& local, const Vector2D& monitorSize) const {
+    const int X = local.x / monitorSize.x * columns;
+    const int Y = local.y / monitorSize.y * columns;
+
+    return std::clamp(X + (Y + scrollRow) * columns, 0, (int)tiles - 1);
+}
+
+Vector2D SOverviewGrid::zoomedSize(const Vector2D& monitorSize) const {
+    return monitorSize * monitorSize / (monitorSize / columns);
+}
+
+Vector2D SOverviewGrid::zoomedPos(int id, const Vector2D& monitorSize, double scale) const {
+    const Vector2D TILESIZE = monitorSize / columns;
+    return (-(TILESIZE * tileCoords(id)) * scale) * (monitorSize / TILESIZE);
+}
+
+float lerp(float from, float to, float perc) {
+    return (to - from) * perc + from;
+}
+
+Vector2D lerp(const Vector2D& from, const Vector2D& to, float perc) {
+    return Vector2D{lerp(from.x, to.x, perc), lerp(from.y, to.y, perc)};
+}
+
+double animatedGap(double gap, double percent, bool closing) {
+    return (closing ? (1.0 - percent) : percent) * gap;
+}
+
+float swipeProgress(double delta, double distance) {
+    return 1.0 - std::clamp(delta / distance, 0.0, 1.0);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <hyprutils/math/Box.hpp>
+#include <hyprutils/math/Vector2D.hpp>
+#include <cstddef>
+
+using Hyprutils::Math::CBox;
+using Hyprutils::Math::Vector2D;
+
+// The overview's grid geometry and animation math. Only plain numbers go in and out,
+// nothing in here knows about monitors, workspaces or the renderer.
+struct SOverviewGrid {
+    int      columns   = 3;
+    size_t   tiles     = 9;
+    // first row in the viewport
+    int      scrollRow = 0;
+
+    int      maxScrollRow() const;
+    // the scroll row that puts a tile's row in the middle of the viewport, as far as the grid allows
+    int      scrollRowFor(int id) const;
+    // inside the viewport
+    bool     isVisible(int id) const;
+    // inside the viewport or a row away from it
+    bool     isResident(int id) const;
+    // column / row of a tile relative to the viewport
+    Vector2D tileCoords(int id) const;
+    // chebyshev distance in tiles
+    int      tileDistance(int a, int b) const;
+    // where a tile sits in a grid of gridSize with gap between tiles
+    CBox     tileBox(int id, const Vector2D& gridSize, double gap) const;
+    // the tile under a point in monitor-local logical coords, clamped to the grid
+    int      tileAt(const Vector2D& local, const Vector2D& monitorSize) const;
+
+    // size and position of the grid when zoomed all the way in on a tile
+    Vector2D zoomedSize(const Vector2D& monitorSize) const;
+    Vector2D zoomedPos(int id, const Vector2D& monitorSize, double scale) const;
+};
+
+float    lerp(float from, float to, float perc);
+Vector2D lerp(const Vector2D& from, const Vector2D& to, float perc);
+
+// the gap grows in while opening and shrinks away while closing
+double   animatedGap(double gap, double percent, bool closing);
+// 0 is the settled grid, 1 is zoomed in on a tile
+float    swipeProgress(double delta, double distance);
@@ -0,0 +1,325 @@
+#include "ThumbnailCache.hpp"
+#include "ThumbnailCodec.hpp"
+#include "FramebufferPool.hpp"
+#include "overview.hpp"
+
+#include <algorithm>
+#include <any>
+#include <drm_fourcc.h>
+
+#include <hyprland/src/Compositor.hpp>
+#include <hyprland/src/desktop/Workspace.hpp>
+#include <hyprland/src/render/Renderer.hpp>
+#include <hyprland/src/render/OpenGL.hpp>
+
+static size_t fbBytes(const Vector2D& size) {
+    return (size_t)size.x * (size_t)size.y * 4;
+}
+
+// what a thumbnail counts against thumbnail_cache_max_mb, temporary uploads don't
+static size_t storedBytes(const CThumbnailCache::SThumbnail& t) {
+    if (!t.pixels.empty())
+        return t.pixels.size();
+
+    return t.fb ? fbBytes(t.fb->m_size) : 0;
+}
+
+CThumbnailCache::CThumbnailCache() {
+    m_hooks.emplace_back(g_pHookSystem->hookDynamic("workspace", [this](void* self, SCallbackInfo& info, std::any param) { onWorkspace(std::any_cast<PHLWORKSPACE>(param)); }));
+    m_hooks.emplace_back(g_pHookSystem->hookDynamic("preRender", [this](void* self, SCallbackInfo& info, std::any param) { onPreRender(std::any_cast<PHLMONITOR>(param)); }));
+
+    const auto ONWINDOW = [this](void* self, SCallbackInfo& info, std::any param) {
+        const auto PWINDOW = std::any_cast<PHLWINDOW>(param);
+        if (PWINDOW && PWINDOW->m_workspace)
+            markStale(PWINDOW->m_workspace);
+    };
+
+    m_hooks.emplace_back(g_pHookSystem->hookDynamic("openWindow", ONWINDOW));
+    m_hooks.emplace_back(g_pHookSystem->hookDynamic("closeWindow", ONWINDOW));
+    m_hooks.emplace_back(g_pHookSystem->hookDynamic("moveWindow", [this](void* self, SCallbackInfo& info, std::any param) {
+        const auto DATA = std::any_cast<std::vector<std::any>>(param);
+        if (DATA.size() < 2)
+            return;
+
+        // windows are mostly moved off the visible workspace, which gets captured when it's left anyway
+        markStale(std::any_cast<PHLWORKSPACE>(DATA[1]));
+    }));
+}
+
+CThumbnailCache::~CThumbnailCache() {
+    clear();
+}
+
+const CThumbnailCache::SThumbnail* CThumbnailCache::get(WORKSPACEID id) {
+    auto it = std::ranges::find_if(m_thumbnails, [id](const auto& t) { return t.workspaceID == id; });
+    if (it == m_thumbnails.end()) {
+        m_stats.misses++;
+        return nullptr;
+    }
+
+    if (!it->fb && !upload(*it)) {
+        m_stats.misses++;
+        return nullptr;
+    }
+
+    m_stats.hits++;
+    it->lastUsed = Time::steadyNow();
+
+    return &*it;
+}
+
+size_t CThumbnailCache::vramSaved() const {
+    size_t saved = 0;
+    for (const auto& t : m_thumbnails) {
+        if (t.pixels.empty())
+            continue;
+
+        // captured at twice the stored size, and only half of that is in VRAM while uploaded
+        saved += fbBytes(t.pixelSize * 2) - (t.fb ? fbBytes(t.pixelSize) : 0);
+    }
+
+    return saved;
+}
+
+void CThumbnailCache::markStale(PHLWORKSPACE ws) {
+    static auto* const* PENABLE = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_cache")->getDataStaticPtr();
+
+    if (!**PENABLE || !ws)
+        return;
+
+    for (auto& t : m_thumbnails) {
+        if (t.workspaceID != ws->m_id)
+            continue;
+
+        t.stale = true;
+        break;
+    }
+
+    if (!ws->isVisible() && std::ranges::find(m_queue, ws) == m_queue.end())
+        m_queue.emplace_back(ws);
+}
+
+void CThumbnailCache::onWindowDamaged(PHLWINDOW pWindow) {
+    // the visible workspace is captured once it's left, that already covers whatever it does until then
+    if (!pWindow->m_isMapped || !pWindow->m_workspace || pWindow->m_workspace->isVisible())
+        return;
+
+    markStale(pWindow->m_workspace);
+}
+
+void CThumbnailCache::clear() {
+    if (m_thumbnails.empty())
+        return;
+
+    // the overview might still hold some of these, in that case it'll free them
+    g_pHyprRenderer->makeEGLCurrent();
+    m_thumbnails.clear();
+    m_queue.clear();
+    m_stats.bytes = 0;
+    m_uploaded    = 0;
+}
+
+void CThumbnailCache::onWorkspace(PHLWORKSPACE ws) {
+    static auto* const* PENABLE = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_cache")->getDataStaticPtr();
+
+    if (!**PENABLE || !ws)
+        return;
+
+    const auto PMONITOR = ws->m_monitor.lock();
+    if (!PMONITOR)
+        return;
+
+    const auto LAST = m_lastActive[PMONITOR->m_id].lock();
+    m_lastActive[PMONITOR->m_id] = ws;
+
+    // what's on screen now will have changed by the time anyone looks at its thumbnail
+    markStale(ws);
+
+    if (LAST && LAST != ws && std::ranges::find(m_queue, LAST) == m_queue.end())
+        m_queue.emplace_back(LAST);
+}
+
+void CThumbnailCache::onPreRender(PHLMONITOR pMonitor) {
+    static auto* const* PENABLE    = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_cache")->getDataStaticPtr();
+    static auto* const* PREFRESHMS = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_refresh_ms")->getDataStaticPtr();
+
+    // uploads only live as long as some overview might be showing them
+    if (m_uploaded > 0 && g_overviews.empty())
+        dropUploads();
+
+    // an overview on this monitor keeps its own tiles fresh, other monitors keep feeding the cache
+    if (!**PENABLE || m_queue.empty() || getOverviewFor(pMonitor))
+        return;
+
+    if (Time::steadyNow() - m_lastCapture < std::chrono::milliseconds(**PREFRESHMS))
+        return;
+
+    // at most one capture per refresh interval, and only of something that is hidden and done animating away
+    for (auto it = m_queue.begin(); it != m_queue.end(); ++it) {
+        const auto WS = it->lock();
+        if (!WS) {
+            m_queue.erase(it);
+            return;
+        }
+
+        if (WS->m_monitor != pMonitor)
+            continue;
+
+        if (WS->isVisible() || WS->m_renderOffset->isBeingAnimated() || WS->m_alpha->isBeingAnimated())
+            continue;
+
+        if (!pMonitor->m_activeWorkspace || pMonitor->m_activeWorkspace->m_renderOffset->isBeingAnimated() || pMonitor->m_activeWorkspace->m_alpha->isBeingAnimated())
+            return;
+
+        if (capture(pMonitor, WS))
+            m_queue.erase(it);
+
+        return;
+    }
+}
+
+bool CThumbnailCache::capture(PHLMONITOR pMonitor, PHLWORKSPACE ws) {
+    static auto* const* PCOLUMNS = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:columns")->getDataStaticPtr();
+    static auto* const* PSCALE   = (Hyprlang::FLOAT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:lowres_scale")->getDataStaticPtr();
+    static auto* const* PMAXMB    = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_cache_max_mb")->getDataStaticPtr();
+    static auto* const* PCPU      = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_cache_cpu")->getDataStaticPtr();
+    static auto* const* PCOMPRESS = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_cache_compress")->getDataStaticPtr();
+
+    const size_t        MAXBYTES = std::max(**PMAXMB, (Hyprlang::INT)0) * 1024 * 1024;
+
+    // same size as a low-res tile, even so that it halves cleanly for system memory
+    auto SIZE = (pMonitor->m_pixelSize / std::max(**PCOLUMNS, (Hyprlang::INT)1) * std::max(**PSCALE, 0.1F)).floor();
+    if (**PCPU)
+        SIZE = (SIZE / 2.0).floor() * 2.0;
+
+    if (SIZE.x < 2 || SIZE.y < 2 || (!**PCPU && fbBytes(SIZE) > MAXBYTES))
+        return false;
+
+    g_pHyprRenderer->makeEGLCurrent();
+
+    auto it = std::ranges::find_if(m_thumbnails, [&ws](const auto& t) { return t.workspaceID == ws->m_id; });
+    if (it == m_thumbnails.end()) {
+        m_thumbnails.emplace_back(SThumbnail{.workspaceID = ws->m_id});
+        it = m_thumbnails.end() - 1;
+    }
+
+    // the overview might still be holding on to the old fb, so never draw into one that's been handed out
+    m_stats.bytes -= storedBytes(*it);
+    if (it->fb && !it->pixels.empty())
+        m_uploaded--;
+    it->fb.reset();
+    it->pixels.clear();
+    it->compressed = false;
+
+    const auto FORMAT = pMonitor->m_output->state->state().drmFormat;
+
+    g_pHyprRenderer->m_bBlockSurfaceFeedback = true;
+
+    if (**PCPU) {
+        if (!g_pFramebufferPool)
+            g_pFramebufferPool = makeUnique<CFramebufferPool>();
+
+        const auto FB = g_pFramebufferPool->acquire(SIZE, FORMAT);
+        renderWorkspaceToFramebuffer(pMonitor, ws, FB.get(), CBox{{}, SIZE});
+        readBack(*it, FB.get(), **PCOMPRESS);
+        g_pFramebufferPool->release(FB);
+    } else {
+        it->fb = makeShared<CFramebuffer>();
+        it->fb->alloc(SIZE.x, SIZE.y, FORMAT);
+        renderWorkspaceToFramebuffer(pMonitor, ws, it->fb.get(), CBox{{}, SIZE});
+    }
+
+    g_pHyprRenderer->m_bBlockSurfaceFeedback = false;
+
+    m_stats.bytes += storedBytes(*it);
+
+    it->stale        = false;
+    it->lastCaptured = Time::steadyNow();
+    it->lastUsed     = it->lastCaptured;
+
+    m_lastCapture = it->lastCaptured;
+    m_stats.captures++;
+
+    trim(MAXBYTES);
+
+    return true;
+}
+
+void CThumbnailCache::readBack(SThumbnail& thumb, CFramebuffer* fb, bool compress) {
+    const int            W = fb->m_size.x;
+    const int            H = fb->m_size.y;
+
+    std::vector<uint8_t> raw((size_t)W * H * 4);
+
+    fb->bind();
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, W, H, GL_RGBA, GL_UNSIGNED_BYTE, raw.data());
+
+    thumb.pixelSize = {W / 2, H / 2};
+    thumb.pixels.resize((size_t)(W / 2) * (H / 2) * 4);
+    downscaleBox2x(raw.data(), W, H, thumb.pixels.data());
+
+    if (!compress)
+        return;
+
+    auto packed = compressPixels(thumb.pixels.data(), thumb.pixels.size() / 4);
+    if (packed.empty())
+        return;
+
+    thumb.pixels     = std::move(packed);
+    thumb.compressed = true;
+}
+
+bool CThumbnailCache::upload(SThumbnail& thumb) {
+    if (thumb.pixels.empty())
+        return false;
+
+    const size_t         PIXELS = (size_t)thumb.pixelSize.x * (size_t)thumb.pixelSize.y;
+
+    std::vector<uint8_t> unpacked;
+    if (thumb.compressed) {
+        unpacked.resize(PIXELS * 4);
+        if (!decompressPixels(thumb.pixels, unpacked.data(), PIXELS)) {
+            Debug::log(ERR, "[he] thumbnail cache: corrupt thumbnail for workspace {}", thumb.workspaceID);
+            return false;
+        }
+    }
+
+    g_pHyprRenderer->makeEGLCurrent();
+
+    // not pooled: once handed out, the overview can hold on to it for longer than we do
+    thumb.fb = makeShared<CFramebuffer>();
+    // pixels were read back as RGBA8 whatever the monitor's format, a 10-bit fb wouldn't take them
+    thumb.fb->alloc(thumb.pixelSize.x, thumb.pixelSize.y, DRM_FORMAT_ABGR8888);
+
+    glBindTexture(GL_TEXTURE_2D, thumb.fb->getTexture()->m_texID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, thumb.pixelSize.x, thumb.pixelSize.y, GL_RGBA, GL_UNSIGNED_BYTE, thumb.compressed ? unpacked.data() : thumb.pixels.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    m_uploaded++;
+    m_stats.uploads++;
+
+    return true;
+}
+
+void CThumbnailCache::dropUploads() {
+    g_pHyprRenderer->makeEGLCurrent();
+
+    for (auto& t : m_thumbnails) {
+        if (!t.pixels.empty())
+            t.fb.reset();
+    }
+
+    m_uploaded = 0;
+}
+
+void CThumbnailCache::trim(size_t maxBytes) {
+    while (m_stats.bytes > maxBytes && !m_thumbnails.empty()) {
+        auto lru = std::ranges::min_element(m_thumbnails, [](const auto& a, const auto& b) { return a.lastUsed < b.lastUsed; });
+        m_stats.bytes -= storedBytes(*lru);
+        if (lru->fb && !lru->pixels.empty())
+            m_uploaded--;
+        m_thumbnails.erase(lru);
+    }
+}
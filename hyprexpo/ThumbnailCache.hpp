@@ -0,0 +1,70 @@
+#pragma once
+
+#define WLR_USE_UNSTABLE
+
+#include "globals.hpp"
+#include <hyprland/src/desktop/DesktopTypes.hpp>
+#include <hyprland/src/render/Framebuffer.hpp>
+#include <hyprland/src/helpers/time/Time.hpp>
+#include <hyprland/src/managers/HookSystemManager.hpp>
+#include <unordered_map>
+#include <vector>
+
+// Downscaled snapshots of workspaces, taken while the overview is closed so
+// that opening it can show something right away instead of capturing every tile.
+class CThumbnailCache {
+  public:
+    CThumbnailCache();
+    ~CThumbnailCache();
+
+    struct SThumbnail {
+        SP<CFramebuffer>     fb;
+        WORKSPACEID          workspaceID = WORKSPACE_INVALID;
+        bool                 stale       = false;
+        Time::steady_tp      lastCaptured;
+        Time::steady_tp      lastUsed;
+
+        // with thumbnail_cache_cpu the image lives here, fb is only uploaded while an overview is open
+        std::vector<uint8_t> pixels;
+        Vector2D             pixelSize;
+        bool                 compressed = false;
+    };
+
+    // nullptr if nothing is cached for the workspace. Uploads thumbnails kept in system memory.
+    const SThumbnail* get(WORKSPACEID id);
+
+    void              markStale(PHLWORKSPACE ws);
+    // a window committed or got damaged, hidden workspaces are refreshed from that at most every thumbnail_refresh_ms
+    void              onWindowDamaged(PHLWINDOW pWindow);
+    void              clear();
+
+    // VRAM the thumbnails in system memory would take as tile-sized framebuffers, minus live uploads
+    size_t            vramSaved() const;
+
+    struct {
+        uint64_t captures = 0;
+        uint64_t hits     = 0;
+        uint64_t misses   = 0;
+        uint64_t uploads  = 0;
+        size_t   bytes    = 0;
+    } m_stats;
+
+  private:
+    void                                           onWorkspace(PHLWORKSPACE ws);
+    void                                           onPreRender(PHLMONITOR pMonitor);
+    bool                                           capture(PHLMONITOR pMonitor, PHLWORKSPACE ws);
+    void                                           readBack(SThumbnail& thumb, CFramebuffer* fb, bool compress);
+    bool                                           upload(SThumbnail& thumb);
+    void                                           dropUploads();
+    void                                           trim(size_t maxBytes);
+
+    std::vector<SThumbnail>                        m_thumbnails;
+    std::vector<PHLWORKSPACEREF>                   m_queue; // hidden workspaces waiting for a capture
+    std::unordered_map<MONITORID, PHLWORKSPACEREF> m_lastActive;
+    Time::steady_tp                                m_lastCapture;
+    size_t                                         m_uploaded = 0;
+
+    std::vector<SP<HOOK_CALLBACK_FN>>              m_hooks;
+};
+
+inline UP<CThumbnailCache> g_pThumbnailCache;
@@ -0,0 +1,123 @@
+#include "ThumbnailCodec.hpp"
+
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// (a + b + c + d + 2) / 4 per channel, the rounding both vector paths give us for free
+static void downscaleRow(const uint8_t* row0, const uint8_t* row1, int from, int to, uint8_t* dst) {
+    for (int x = from; x < to; ++x) {
+        const uint8_t* A = row0 + x * 8;
+        const uint8_t* B = row1 + x * 8;
+
+        for (int c = 0; c < 4; ++c) {
+            dst[x * 4 + c] = (A[c] + A[c + 4] + B[c] + B[c + 4] + 2) >> 2;
+        }
+    }
+}
+
+void downscaleBox2xScalar(const uint8_t* src, int w, int h, uint8_t* dst) {
+    const int    OUTW   = w / 2;
+    const int    OUTH   = h / 2;
+    const size_t STRIDE = (size_t)w * 4;
+
+    for (int y = 0; y < OUTH; ++y) {
+        downscaleRow(src + 2 * y * STRIDE, src + (2 * y + 1) * STRIDE, 0, OUTW, dst + (size_t)y * OUTW * 4);
+    }
+}
+
+void downscaleBox2x(const uint8_t* src, int w, int h, uint8_t* dst) {
+#if defined(__SSE2__) || defined(__ARM_NEON)
+    const int    OUTW   = w / 2;
+    const int    OUTH   = h / 2;
+    const size_t STRIDE = (size_t)w * 4;
+
+    for (int y = 0; y < OUTH; ++y) {
+        const uint8_t* ROW0 = src + 2 * y * STRIDE;
+        const uint8_t* ROW1 = src + (2 * y + 1) * STRIDE;
+        uint8_t*       OUT  = dst + (size_t)y * OUTW * 4;
+
+        // 4 source pixels from each row make 2 output pixels
+        int x = 0;
+        for (; x + 2 <= OUTW; x += 2) {
+#if defined(__SSE2__)
+            const __m128i ZERO = _mm_setzero_si128();
+            const __m128i A    = _mm_loadu_si128((const __m128i*)(ROW0 + x * 8));
+            const __m128i B    = _mm_loadu_si128((const __m128i*)(ROW1 + x * 8));
+
+            // vertical sums, 16 bits per channel
+            const __m128i LO = _mm_add_epi16(_mm_unpacklo_epi8(A, ZERO), _mm_unpacklo_epi8(B, ZERO));
+            const __m128i HI = _mm_add_epi16(_mm_unpackhi_epi8(A, ZERO), _mm_unpackhi_epi8(B, ZERO));
+
+            // horizontal sums: each half of LO / HI is one source pixel
+            const __m128i SUM = _mm_unpacklo_epi64(_mm_add_epi16(LO, _mm_srli_si128(LO, 8)), _mm_add_epi16(HI, _mm_srli_si128(HI, 8)));
+            const __m128i AVG = _mm_srli_epi16(_mm_add_epi16(SUM, _mm_set1_epi16(2)), 2);
+
+            _mm_storel_epi64((__m128i*)(OUT + x * 4), _mm_packus_epi16(AVG, ZERO));
+#else
+            const uint8x16_t A = vld1q_u8(ROW0 + x * 8);
+            const uint8x16_t B = vld1q_u8(ROW1 + x * 8);
+
+            const uint16x8_t LO = vaddl_u8(vget_low_u8(A), vget_low_u8(B));
+            const uint16x8_t HI = vaddl_u8(vget_high_u8(A), vget_high_u8(B));
+
+            const uint16x8_t SUM = vcombine_u16(vadd_u16(vget_low_u16(LO), vget_high_u16(LO)), vadd_u16(vget_low_u16(HI), vget_high_u16(HI)));
+
+            vst1_u8(OUT + x * 4, vrshrn_n_u16(SUM, 2));
+#endif
+        }
+
+        downscaleRow(ROW0, ROW1, x, OUTW, OUT);
+    }
+#else
+    downscaleBox2xScalar(src, w, h, dst);
+#endif
+}
+
+std::vector<uint8_t> compressPixels(const uint8_t* src, size_t pixels) {
+    const size_t         RAWBYTES = pixels * 4;
+
+    std::vector<uint8_t> out;
+    out.reserve(RAWBYTES / 4);
+
+    for (size_t i = 0; i < pixels;) {
+        size_t run = 1;
+        while (i + run < pixels && run < 255 && std::memcmp(src + i * 4, src + (i + run) * 4, 4) == 0) {
+            run++;
+        }
+
+        // not worth it, let the caller keep the raw pixels
+        if (out.size() + 5 >= RAWBYTES)
+            return {};
+
+        out.emplace_back((uint8_t)run);
+        out.insert(out.end(), src + i * 4, src + i * 4 + 4);
+
+        i += run;
+    }
+
+    out.shrink_to_fit();
+    return out;
+}
+
+bool decompressPixels(const std::vector<uint8_t>& data, uint8_t* dst, size_t pixels) {
+    size_t written = 0;
+
+    for (size_t i = 0; i + 5 <= data.size(); i += 5) {
+        const size_t RUN = data[i];
+        if (RUN == 0 || written + RUN > pixels)
+            return false;
+
+        for (size_t r = 0; r < RUN; ++r) {
+            std::memcpy(dst + (written + r) * 4, data.data() + i + 1, 4);
+        }
+
+        written += RUN;
+    }
+
+    return written == pixels && data.size() % 5 == 0;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Pixel kernels for thumbnails kept in system memory. Plain buffers in, plain buffers out,
+// nothing here touches GL or the compositor, so they can be timed outside of Hyprland.
+
+// Halves a tightly packed RGBA8 image in both directions with a 2x2 box filter.
+// An odd last row / column is dropped. dst must hold (w / 2) * (h / 2) * 4 bytes.
+void                 downscaleBox2x(const uint8_t* src, int w, int h, uint8_t* dst);
+// the same without SIMD, results are bit-identical
+void                 downscaleBox2xScalar(const uint8_t* src, int w, int h, uint8_t* dst);
+
+// Run-length encodes 32-bit pixels as [run length][pixel] pairs. Desktops are mostly flat
+// colour, so this tends to pay off. Returns an empty vector if it wouldn't make the data smaller.
+std::vector<uint8_t> compressPixels(const uint8_t* src, size_t pixels);
+// false if data doesn't decode to exactly the given number of pixels
+bool                 decompressPixels(const std::vector<uint8_t>& data, uint8_t* dst, size_t pixels);
@@ -0,0 +1,84 @@
+#include "Trace.hpp"
+
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <unistd.h>
+
+// keeps a trace left running for hours from eating memory, about 2MB worth of events
+constexpr size_t MAX_TRACE_EVENTS = 65536;
+
+CTraceRecorder::CTraceRecorder() : m_epoch(Time::steadyNow()) {
+    ;
+}
+
+bool CTraceRecorder::enabled() const {
+    static auto* const* PTRACE = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:trace")->getDataStaticPtr();
+
+    return **PTRACE;
+}
+
+void CTraceRecorder::record(const char* name, const Time::steady_tp& begin, const Time::steady_tp& end, int64_t arg) {
+    if (m_events.size() >= MAX_TRACE_EVENTS)
+        m_events.pop_front();
+
+    m_events.emplace_back(STraceEvent{name, begin, end - begin, arg});
+}
+
+bool CTraceRecorder::dump(const std::string& path) {
+    std::ofstream ofs(path, std::ios::trunc);
+    if (!ofs.good())
+        return false;
+
+    const auto PID = getpid();
+
+    ofs << "{\"traceEvents\":[\n";
+    for (size_t i = 0; i < m_events.size(); ++i) {
+        const auto& e   = m_events[i];
+        const auto  TS  = std::chrono::duration<double, std::micro>(e.begin - m_epoch).count();
+        const auto  DUR = std::chrono::duration<double, std::micro>(e.duration).count();
+
+        ofs << std::format(R"({{"name":"{}","cat":"hyprexpo","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":{},"tid":1)", e.name, TS, DUR, PID);
+        if (e.arg >= 0)
+            ofs << std::format(R"(,"args":{{"id":{}}})", e.arg);
+        ofs << (i + 1 < m_events.size() ? "},\n" : "}\n");
+    }
+    ofs << "],\"displayTimeUnit\":\"ms\"}\n";
+
+    ofs.close();
+    if (ofs.fail())
+        return false;
+
+    m_events.clear();
+    return true;
+}
+
+void CTraceRecorder::clear() {
+    m_events.clear();
+}
+
+std::string CTraceRecorder::defaultPath() const {
+    const auto RUNTIMEDIR = getenv("XDG_RUNTIME_DIR");
+
+    return std::string{RUNTIMEDIR ? RUNTIMEDIR : "/tmp"} + "/hyprexpo-trace.json";
+}
+
+CScopedTrace::CScopedTrace(const char* name, int64_t arg) : m_name(name), m_arg(arg) {
+    m_active = g_pTraceRecorder && g_pTraceRecorder->enabled();
+    if (m_active)
+        m_begin = Time::steadyNow();
+}
+
+CScopedTrace::~CScopedTrace() {
+    finish();
+}
+
+void CScopedTrace::finish() {
+    if (!m_active)
+        return;
+
+    m_active = false;
+
+    if (g_pTraceRecorder)
+        g_pTraceRecorder->record(m_name, m_begin, Time::steadyNow(), m_arg);
+}
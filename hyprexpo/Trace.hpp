@@ -0,0 +1,54 @@
+#pragma once
+
+#define WLR_USE_UNSTABLE
+
+#include "globals.hpp"
+#include <hyprland/src/helpers/time/Time.hpp>
+#include <deque>
+#include <string>
+
+// Collects scoped timings of the overview (open phases, redraws, frames) and
+// writes them out as a Chrome trace, viewable in chrome://tracing or ui.perfetto.dev.
+// Nothing is recorded unless plugin:hyprexpo:trace is set.
+class CTraceRecorder {
+  public:
+    CTraceRecorder();
+
+    bool        enabled() const;
+    void        record(const char* name, const Time::steady_tp& begin, const Time::steady_tp& end, int64_t arg);
+    // writes everything recorded so far to path and forgets it
+    bool        dump(const std::string& path);
+    void        clear();
+
+    // $XDG_RUNTIME_DIR/hyprexpo-trace.json, or /tmp if that's unset
+    std::string defaultPath() const;
+
+  private:
+    struct STraceEvent {
+        const char*      name = nullptr;
+        Time::steady_tp  begin;
+        Time::steady_dur duration;
+        int64_t          arg = -1;
+    };
+
+    std::deque<STraceEvent> m_events;
+    Time::steady_tp         m_epoch;
+};
+
+inline UP<CTraceRecorder> g_pTraceRecorder;
+
+// Times the enclosing scope, or up to an explicit finish(). name has to outlive the recorder,
+// in practice it's always a string literal.
+class CScopedTrace {
+  public:
+    CScopedTrace(const char* name, int64_t arg = -1);
+    ~CScopedTrace();
+
+    void finish();
+
+  private:
+    const char*     m_name   = nullptr;
+    int64_t         m_arg    = -1;
+    bool            m_active = false;
+    Time::steady_tp m_begin;
+};
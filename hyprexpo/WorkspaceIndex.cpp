@@ -0,0 +1,68 @@
+#include "WorkspaceIndex.hpp"
+
+#include <algorithm>
+#include <any>
+
+#include <hyprland/src/Compositor.hpp>
+#include <hyprland/src/desktop/Workspace.hpp>
+
+CWorkspaceIndex::CWorkspaceIndex() {
+    // rebuilt lazily, a burst of events only costs one pass over the workspaces
+    const auto INVALIDATE = [this](void* self, SCallbackInfo& info, std::any param) { m_dirty = true; };
+
+    m_hooks.emplace_back(g_pHookSystem->hookDynamic("createWorkspace", INVALIDATE));
+    m_hooks.emplace_back(g_pHookSystem->hookDynamic("destroyWorkspace", INVALIDATE));
+    m_hooks.emplace_back(g_pHookSystem->hookDynamic("moveWorkspace", INVALIDATE));
+    m_hooks.emplace_back(g_pHookSystem->hookDynamic("monitorAdded", INVALIDATE));
+    m_hooks.emplace_back(g_pHookSystem->hookDynamic("monitorRemoved", INVALIDATE));
+}
+
+void CWorkspaceIndex::rebuild() {
+    m_owners.clear();
+
+    for (const auto& ws : g_pCompositor->m_workspaces) {
+        if (!ws || ws->m_isSpecialWorkspace || !ws->m_monitor)
+            continue;
+
+        m_owners[ws->m_id] = ws->m_monitor->m_id;
+    }
+
+    m_dirty = false;
+}
+
+bool CWorkspaceIndex::usableOn(WORKSPACEID id, MONITORID monitor) const {
+    const auto IT = m_owners.find(id);
+    return IT == m_owners.end() || IT->second == monitor;
+}
+
+std::vector<WORKSPACEID> CWorkspaceIndex::slice(PHLMONITOR pMonitor, WORKSPACEID startID, size_t count, bool centered) {
+    if (m_dirty)
+        rebuild();
+
+    std::vector<WORKSPACEID> ids;
+    ids.reserve(count);
+
+    if (count == 0 || !pMonitor)
+        return ids;
+
+    const auto MONITOR = pMonitor->m_id;
+
+    // as many below the start as fit in the first half, going down stops at 1 just like "r-N"
+    if (centered) {
+        for (WORKSPACEID id = startID - 1; id >= 1 && ids.size() + 1 < count / 2; --id) {
+            if (usableOn(id, MONITOR))
+                ids.emplace_back(id);
+        }
+
+        std::ranges::reverse(ids);
+    }
+
+    ids.emplace_back(startID);
+
+    for (WORKSPACEID id = std::max(startID + 1, (WORKSPACEID)1); ids.size() < count; ++id) {
+        if (usableOn(id, MONITOR))
+            ids.emplace_back(id);
+    }
+
+    return ids;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#define WLR_USE_UNSTABLE
+
+#include "globals.hpp"
+#include <hyprland/src/desktop/DesktopTypes.hpp>
+#include <hyprland/src/managers/HookSystemManager.hpp>
+#include <map>
+#include <vector>
+
+// Which monitor owns which workspace ID, kept sorted and up to date from workspace events.
+// Lets the overview lay out its tiles the way "r+N" / "r-N" would resolve them, without
+// going through the dispatcher string parser once per tile.
+class CWorkspaceIndex {
+  public:
+    CWorkspaceIndex();
+
+    // count IDs usable on pMonitor: starting at startID, or with startID in the middle when
+    // centered. IDs that live on other monitors are skipped, like "r+N" does.
+    std::vector<WORKSPACEID> slice(PHLMONITOR pMonitor, WORKSPACEID startID, size_t count, bool centered);
+
+  private:
+    void                              rebuild();
+    bool                              usableOn(WORKSPACEID id, MONITORID monitor) const;
+
+    std::map<WORKSPACEID, MONITORID>  m_owners;
+    bool                              m_dirty = true;
+
+    std::vector<SP<HOOK_CALLBACK_FN>> m_hooks;
+};
+
+inline UP<CWorkspaceIndex> g_pWorkspaceIndex;
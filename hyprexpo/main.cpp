@@ -1,22 +1,139 @@
 #define WLR_USE_UNSTABLE
 
 #include <unistd.h>
+#include <algorithm>
 
 #include <hyprland/src/Compositor.hpp>
 #include <hyprland/src/desktop/Window.hpp>
 #include <hyprland/src/config/ConfigManager.hpp>
 #include <hyprland/src/desktop/DesktopTypes.hpp>
 #include <hyprland/src/render/Renderer.hpp>
+#include <hyprland/src/render/OpenGL.hpp>
+#define private public
+#include <hyprland/src/desktop/Subsurface.hpp>
+#undef private
 
 #include "globals.hpp"
+#include "overview.hpp"
+#include "FramebufferPool.hpp"
+#include "ThumbnailCache.hpp"
+#include "Trace.hpp"
+#include "WorkspaceIndex.hpp"
+
+inline CFunctionHook* g_pRenderWorkspaceHook = nullptr;
+inline CFunctionHook* g_pAddDamageHookA      = nullptr;
+inline CFunctionHook* g_pAddDamageHookB      = nullptr;
+inline CFunctionHook* g_pCommitWindowHook     = nullptr;
+inline CFunctionHook* g_pCommitSubsurfaceHook = nullptr;
+inline CFunctionHook* g_pDamageWindowHook     = nullptr;
+typedef void (*origRenderWorkspace)(void*, PHLMONITOR, PHLWORKSPACE, timespec*, const CBox&);
+typedef void (*origAddDamageA)(void*, const CBox&);
+typedef void (*origAddDamageB)(void*, const pixman_region32_t*);
+typedef void (*origCommitWindow)(void*, void*);
+typedef void (*origCommitSubsurface)(CSubsurface*);
+typedef void (*origDamageWindow)(void*, PHLWINDOW, bool);
+
+// hooked: renderWorkspace is replaced and damage is routed per tile.
+// fallback: the overview is drawn from the render event on top of the workspace, tiles only update on their own.
+enum eRenderPath : uint8_t {
+    RENDER_PATH_HOOKED = 0,
+    RENDER_PATH_FALLBACK,
+};
+
+static eRenderPath g_renderPath = RENDER_PATH_FALLBACK;
 
 // Do NOT change this function.
 APICALL EXPORT std::string PLUGIN_API_VERSION() {
     return HYPRLAND_API_VERSION;
 }
 
-static bool pluginInitialized = false;
-static bool overviewActive = false;
+static bool         renderingOverview = false;
+
+// the window whose commit or damage is being handled, damage reported meanwhile is that window's
+static PHLWINDOWREF damagingWindow;
+
+//
+static void hkRenderWorkspace(void* thisptr, PHLMONITOR pMonitor, PHLWORKSPACE pWorkspace, timespec* now, const CBox& geometry) {
+    const auto PO = getOverviewFor(pMonitor);
+
+    if (!PO || renderingOverview || PO->blockOverviewRendering)
+        ((origRenderWorkspace)(g_pRenderWorkspaceHook->m_original))(thisptr, pMonitor, pWorkspace, now, geometry);
+    else
+        PO->render();
+}
+
+static void hkAddDamageA(void* thisptr, const CBox& box) {
+    const auto PMONITOR = (CMonitor*)thisptr;
+    const auto PO       = getOverviewFor(PMONITOR->m_self.lock());
+
+    if (!PO || PO->blockDamageReporting || !PO->onDamageReported(CRegion{box}, damagingWindow.lock()))
+        ((origAddDamageA)g_pAddDamageHookA->m_original)(thisptr, box);
+}
+
+static void hkAddDamageB(void* thisptr, const pixman_region32_t* rg) {
+    const auto PMONITOR = (CMonitor*)thisptr;
+    const auto PO       = getOverviewFor(PMONITOR->m_self.lock());
+
+    if (!PO || PO->blockDamageReporting || !PO->onDamageReported(CRegion{rg}, damagingWindow.lock()))
+        ((origAddDamageB)g_pAddDamageHookB->m_original)(thisptr, rg);
+}
+
+static void onWindowDamaged(PHLWINDOW pWindow) {
+    if (!pWindow)
+        return;
+
+    if (g_pThumbnailCache)
+        g_pThumbnailCache->onWindowDamaged(pWindow);
+
+    if (const auto PO = getOverviewFor(pWindow->m_monitor.lock()); PO)
+        PO->onWindowDamaged(pWindow);
+}
+
+static void hkCommitWindow(void* owner, void* data) {
+    const auto PWINDOW = ((CWindow*)owner)->m_self.lock();
+    const auto PREV    = damagingWindow;
+
+    onWindowDamaged(PWINDOW);
+
+    damagingWindow = PWINDOW;
+    ((origCommitWindow)g_pCommitWindowHook->m_original)(owner, data);
+    damagingWindow = PREV;
+}
+
+static void hkCommitSubsurface(CSubsurface* thisptr) {
+    const auto PWINDOW = thisptr->m_wlSurface ? thisptr->m_wlSurface->getWindow() : nullptr;
+    const auto PREV    = damagingWindow;
+
+    onWindowDamaged(PWINDOW);
+
+    damagingWindow = PWINDOW;
+    ((origCommitSubsurface)g_pCommitSubsurfaceHook->m_original)(thisptr);
+    damagingWindow = PREV;
+}
+
+// window moves and resizes damage through here without a commit
+static void hkDamageWindow(void* thisptr, PHLWINDOW pWindow, bool forceFull) {
+    const auto PREV = damagingWindow;
+
+    onWindowDamaged(pWindow);
+
+    damagingWindow = pWindow;
+    ((origDamageWindow)g_pDamageWindowHook->m_original)(thisptr, pWindow, forceFull);
+    damagingWindow = PREV;
+}
+
+static void onRenderStage(eRenderStage stage) {
+    if (g_renderPath != RENDER_PATH_FALLBACK || stage != RENDER_POST_WINDOWS)
+        return;
+
+    const auto PO = getOverviewFor(g_pHyprOpenGL->m_renderData.pMonitor.lock());
+
+    // tile captures render workspaces too, those must not draw the overview into themselves
+    if (!PO || renderingOverview || PO->blockOverviewRendering)
+        return;
+
+    PO->render();
+}
 
 static float gestured       = 0;
 bool         swipeActive    = false;
@@ -28,8 +145,6 @@ static void  swipeBegin(void* self, SCallbackInfo& info, std::any param) {
 }
 
 static void swipeUpdate(void* self, SCallbackInfo& info, std::any param) {
-    if (!pluginInitialized) return;
-    
     static auto* const* PENABLE   = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:enable_gesture")->getDataStaticPtr();
     static auto* const* FINGERS   = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:gesture_fingers")->getDataStaticPtr();
     static auto* const* PPOSITIVE = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:gesture_positive")->getDataStaticPtr();
@@ -45,7 +160,7 @@ static void swipeUpdate(void* self, SCallbackInfo& info, std::any param) {
             swipeDirection = 0;
     }
 
-    if (swipeActive || overviewActive)
+    if (swipeActive || focusedOverview())
         info.cancelled = true;
 
     if (!**PENABLE || e.fingers != **FINGERS || swipeDirection != 'v')
@@ -53,141 +168,288 @@ static void swipeUpdate(void* self, SCallbackInfo& info, std::any param) {
 
     info.cancelled = true;
     if (!swipeActive) {
-        if (overviewActive && (**PPOSITIVE ? 1.0 : -1.0) * e.delta.y <= 0) {
-            gestured = **PDISTANCE;
-            swipeActive = true;
+        if (focusedOverview() && (**PPOSITIVE ? 1.0 : -1.0) * e.delta.y <= 0) {
+            renderingOverview = true;
+            openOverview(g_pCompositor->m_lastMonitor->m_activeWorkspace, true);
+            renderingOverview = false;
+            gestured          = **PDISTANCE;
+            swipeActive       = true;
         }
-        else if (!overviewActive && (**PPOSITIVE ? 1.0 : -1.0) * e.delta.y > 0) {
-            overviewActive = true;
-            gestured = 0;
-            swipeActive = true;
-            HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Overview activated via gesture", CHyprColor{0.2, 0.8, 0.2, 1.0}, 2000);
+
+        else if (!focusedOverview() && (**PPOSITIVE ? 1.0 : -1.0) * e.delta.y > 0) {
+            renderingOverview = true;
+            openOverview(g_pCompositor->m_lastMonitor->m_activeWorkspace, true);
+            renderingOverview = false;
+            gestured          = 0;
+            swipeActive       = true;
         }
+
         else {
             return;
         }
     }
 
     gestured += (**PPOSITIVE ? 1.0 : -1.0) * e.delta.y;
-    if (gestured <= 0.01) {
+    if (gestured <= 0.01) // plugin will crash if swipe ends at <= 0
         gestured = 0.01;
-    }
-    
-    // Update overview based on gesture
-    if (gestured >= **PDISTANCE * 0.8) {
-        if (!overviewActive) {
-            overviewActive = true;
-            HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Overview fully activated", CHyprColor{0.2, 0.8, 0.2, 1.0}, 1000);
-        }
-    }
+    focusedOverview()->onSwipeUpdate(gestured);
 }
 
 static void swipeEnd(void* self, SCallbackInfo& info, std::any param) {
-    if (!overviewActive)
+    if (!focusedOverview())
         return;
 
-    swipeActive = false;
+    swipeActive    = false;
     info.cancelled = true;
 
-    if (gestured >= 100) { // Threshold for selection
-        HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Workspace would be selected here", CHyprColor{0.8, 0.8, 0.2, 1.0}, 2000);
-    }
+    focusedOverview()->onSwipeEnd();
+}
+
+static void dumpTrace(std::string path) {
+    if (!g_pTraceRecorder)
+        return;
+
+    if (path.empty())
+        path = g_pTraceRecorder->defaultPath();
+
+    if (!g_pTraceRecorder->enabled())
+        HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Tracing is off, set plugin:hyprexpo:trace to record", CHyprColor{1.0, 0.7, 0.2, 1.0}, 5000);
+    else if (!g_pTraceRecorder->dump(path))
+        HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Failed to write trace to " + path, CHyprColor{1.0, 0.2, 0.2, 1.0}, 5000);
+    else
+        HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Trace written to " + path, CHyprColor{0.2, 1.0, 0.2, 1.0}, 5000);
 }
 
 static void onExpoDispatcher(std::string arg) {
-    if (!pluginInitialized) return;
+    if (arg == "trace" || arg.starts_with("trace ")) {
+        dumpTrace(arg == "trace" ? "" : arg.substr(6));
+        return;
+    }
 
     if (swipeActive)
         return;
-        
-    if (arg == "select") { 
-        if (overviewActive) {
-            HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Workspace selection triggered", CHyprColor{0.8, 0.8, 0.2, 1.0}, 2000);
-            overviewActive = false;
+
+    if (arg == "select") {
+        if (const auto PO = focusedOverview(); PO) {
+            PO->selectHoveredWorkspace();
+            PO->close();
         }
         return;
     }
-    
+
     if (arg == "toggle") {
-        if (overviewActive) {
-            overviewActive = false;
-            HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Overview deactivated", CHyprColor{0.8, 0.2, 0.2, 1.0}, 2000);
-        } else {
-            overviewActive = true;
-            HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Overview activated", CHyprColor{0.2, 0.8, 0.2, 1.0}, 2000);
+        if (focusedOverview())
+            focusedOverview()->close();
+        else {
+            renderingOverview = true;
+            openOverview(g_pCompositor->m_lastMonitor->m_activeWorkspace);
+            renderingOverview = false;
         }
         return;
     }
 
     if (arg == "off" || arg == "close" || arg == "disable") {
-        if (overviewActive) {
-            overviewActive = false;
-            HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Overview deactivated", CHyprColor{0.8, 0.2, 0.2, 1.0}, 2000);
-        }
+        if (focusedOverview())
+            focusedOverview()->close();
         return;
     }
 
-    if (overviewActive)
+    if (focusedOverview())
         return;
 
-    overviewActive = true;
-    HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Overview activated", CHyprColor{0.2, 0.8, 0.2, 1.0}, 2000);
+    renderingOverview = true;
+    openOverview(g_pCompositor->m_lastMonitor->m_activeWorkspace);
+    renderingOverview = false;
 }
 
 static void failNotif(const std::string& reason) {
     HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Failure in initialization: " + reason, CHyprColor{1.0, 0.2, 0.2, 1.0}, 5000);
 }
 
-APICALL EXPORT PLUGIN_DESCRIPTION_INFO PLUGIN_INIT(HANDLE handle) {
-    PHANDLE = handle;
+// owner narrows down the match by the demangled name, e.g. the class a method belongs to
+static CFunctionHook* probeHook(const std::string& name, const std::string& owner, void* destination, std::vector<std::string>& missing) {
+    const auto FNS = HyprlandAPI::findFunctionsByName(PHANDLE, name);
+    const auto FN  = std::ranges::find_if(FNS, [&owner](const auto& fn) { return owner.empty() || fn.demangled.contains(owner); });
+    if (FN == FNS.end()) {
+        missing.emplace_back(name);
+        return nullptr;
+    }
 
-    const std::string HASH = __hyprland_api_get_hash();
+    const auto HOOK = HyprlandAPI::createFunctionHook(PHANDLE, FN->address, destination);
+    if (!HOOK)
+        missing.emplace_back(name);
 
-    if (HASH != GIT_COMMIT_HASH) {
-        failNotif("Version mismatch (headers ver is not equal to running hyprland ver)");
-        throw std::runtime_error("[he] Version mismatch");
+    return HOOK;
+}
+
+static void removeHooks(std::initializer_list<CFunctionHook**> hooks) {
+    for (auto* hook : hooks) {
+        if (!*hook)
+            continue;
+
+        HyprlandAPI::removeFunctionHook(PHANDLE, *hook);
+        *hook = nullptr;
+    }
+}
+
+static void removeRenderHooks() {
+    removeHooks({&g_pRenderWorkspaceHook, &g_pAddDamageHookA, &g_pAddDamageHookB});
+}
+
+static void removeDamageSourceHooks() {
+    removeHooks({&g_pCommitWindowHook, &g_pCommitSubsurfaceHook, &g_pDamageWindowHook});
+}
+
+static std::string missingReason(const std::vector<std::string>& missing) {
+    std::string reason = "no hook target for";
+    for (const auto& m : missing) {
+        reason += " " + m;
+    }
+
+    return reason;
+}
+
+// The commit and damageWindow hooks tell which window damage comes from. The overview dirties tiles with that and
+// the thumbnail cache refreshes hidden workspaces, so they're wanted on either render path.
+static bool probeDamageSources(std::string& reason) {
+    std::vector<std::string> missing;
+
+    g_pCommitWindowHook     = probeHook("listener_commitWindow", "", (void*)hkCommitWindow, missing);
+    g_pCommitSubsurfaceHook = probeHook("onCommit", "CSubsurface", (void*)hkCommitSubsurface, missing);
+    g_pDamageWindowHook     = probeHook("damageWindow", "CHyprRenderer", (void*)hkDamageWindow, missing);
+
+    if (!missing.empty()) {
+        reason = missingReason(missing);
+        removeDamageSourceHooks();
+        return false;
+    }
+
+    bool success = g_pCommitWindowHook->hook();
+    success      = success && g_pCommitSubsurfaceHook->hook();
+    success      = success && g_pDamageWindowHook->hook();
+
+    if (!success) {
+        reason = "failed initializing hooks";
+        removeDamageSourceHooks();
+        return false;
     }
 
-    try {
-        // Minimal ARM64-compatible initialization
-        HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Initializing minimal ARM64-compatible version...", CHyprColor{0.2, 0.8, 0.2, 1.0}, 2000);
+    return true;
+}
+
+// The hooked path needs all three render hooks on top of the damage sources, overview rendering and damage routing go
+// hand in hand. Anything short of that falls back to the hook-free path instead of failing to load.
+static eRenderPath probeRenderPath(std::string& reason) {
+    std::vector<std::string> missing;
 
-        // Register callbacks only (no hooks)
-        static auto P = HyprlandAPI::registerCallbackDynamic(PHANDLE, "preRender", [](void* self, SCallbackInfo& info, std::any param) {
-            // Basic pre-render callback
-        });
+    g_pRenderWorkspaceHook = probeHook("renderWorkspace", "", (void*)hkRenderWorkspace, missing);
+    g_pAddDamageHookB      = probeHook("addDamageEPK15pixman_region32", "", (void*)hkAddDamageB, missing);
+    g_pAddDamageHookA      = probeHook("_ZN8CMonitor9addDamageERKN9Hyprutils4Math4CBoxE", "", (void*)hkAddDamageA, missing);
 
-        static auto P2 = HyprlandAPI::registerCallbackDynamic(PHANDLE, "swipeBegin", [](void* self, SCallbackInfo& info, std::any data) { swipeBegin(self, info, data); });
-        static auto P3 = HyprlandAPI::registerCallbackDynamic(PHANDLE, "swipeEnd", [](void* self, SCallbackInfo& info, std::any data) { swipeEnd(self, info, data); });
-        static auto P4 = HyprlandAPI::registerCallbackDynamic(PHANDLE, "swipeUpdate", [](void* self, SCallbackInfo& info, std::any data) { swipeUpdate(self, info, data); });
+    if (!missing.empty()) {
+        reason = missingReason(missing);
+        removeRenderHooks();
+        return RENDER_PATH_FALLBACK;
+    }
 
-        HyprlandAPI::addDispatcher(PHANDLE, "hyprexpo:expo", onExpoDispatcher);
+    bool success = g_pRenderWorkspaceHook->hook();
+    success      = success && g_pAddDamageHookA->hook();
+    success      = success && g_pAddDamageHookB->hook();
 
-        HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:columns", Hyprlang::INT{3});
-        HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:gap_size", Hyprlang::INT{5});
-        HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:bg_col", Hyprlang::INT{0xFF111111});
-        HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:workspace_method", Hyprlang::STRING{"center current"});
+    if (!success) {
+        reason = "failed initializing hooks";
+        removeRenderHooks();
+        return RENDER_PATH_FALLBACK;
+    }
 
-        HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:enable_gesture", Hyprlang::INT{1});
-        HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:gesture_distance", Hyprlang::INT{200});
-        HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:gesture_positive", Hyprlang::INT{1});
-        HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:gesture_fingers", Hyprlang::INT{4});
+    return RENDER_PATH_HOOKED;
+}
 
-        HyprlandAPI::reloadConfig();
+APICALL EXPORT PLUGIN_DESCRIPTION_INFO PLUGIN_INIT(HANDLE handle) {
+    PHANDLE = handle;
 
-        pluginInitialized = true;
+    const std::string HASH = __hyprland_api_get_hash();
 
-        HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Minimal ARM64-compatible plugin initialized successfully!", CHyprColor{0.2, 0.8, 0.2, 1.0}, 3000);
+    if (HASH != GIT_COMMIT_HASH) {
+        failNotif("Version mismatch (headers ver is not equal to running hyprland ver)");
+        throw std::runtime_error("[he] Version mismatch");
+    }
 
-        return {"hyprexpo", "A plugin for an overview (Minimal ARM64 compatible)", "Vaxry", "1.0"};
+    std::string fallbackReason;
+    const bool  DAMAGESOURCES = probeDamageSources(fallbackReason);
+    g_renderPath              = DAMAGESOURCES ? probeRenderPath(fallbackReason) : RENDER_PATH_FALLBACK;
 
-    } catch (const std::exception& e) {
-        failNotif("Exception during initialization: " + std::string(e.what()));
-        throw;
+    static auto P = HyprlandAPI::registerCallbackDynamic(PHANDLE, "preRender", [](void* self, SCallbackInfo& info, std::any param) {
+        const auto PO = getOverviewFor(std::any_cast<PHLMONITOR>(param));
+        if (!PO)
+            return;
+        PO->onPreRender();
+    });
+
+    static auto P2 = HyprlandAPI::registerCallbackDynamic(PHANDLE, "swipeBegin", [](void* self, SCallbackInfo& info, std::any data) { swipeBegin(self, info, data); });
+    static auto P3 = HyprlandAPI::registerCallbackDynamic(PHANDLE, "swipeEnd", [](void* self, SCallbackInfo& info, std::any data) { swipeEnd(self, info, data); });
+    static auto P4 = HyprlandAPI::registerCallbackDynamic(PHANDLE, "swipeUpdate", [](void* self, SCallbackInfo& info, std::any data) { swipeUpdate(self, info, data); });
+    static auto P5 = HyprlandAPI::registerCallbackDynamic(PHANDLE, "render", [](void* self, SCallbackInfo& info, std::any data) { onRenderStage(std::any_cast<eRenderStage>(data)); });
+
+    HyprlandAPI::addDispatcher(PHANDLE, "hyprexpo:expo", onExpoDispatcher);
+
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:columns", Hyprlang::INT{3});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:gap_size", Hyprlang::INT{5});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:bg_col", Hyprlang::INT{0xFF111111});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:workspace_method", Hyprlang::STRING{"center current"});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:workspace_count", Hyprlang::INT{0});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:progressive_open", Hyprlang::INT{0});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:capture_budget_ms", Hyprlang::FLOAT{4.F});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:live", Hyprlang::INT{0});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:placeholder_col", Hyprlang::INT{0xFF1E1E1E});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:fb_pool_size", Hyprlang::INT{32});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:fb_pool_idle_release_ms", Hyprlang::INT{10000});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:lowres", Hyprlang::INT{0});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:lowres_scale", Hyprlang::FLOAT{1.5F});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_cache", Hyprlang::INT{0});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_cache_max_mb", Hyprlang::INT{64});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_refresh_ms", Hyprlang::INT{1000});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_cache_cpu", Hyprlang::INT{0});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:thumbnail_cache_compress", Hyprlang::INT{0});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:trace", Hyprlang::INT{0});
+
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:enable_gesture", Hyprlang::INT{1});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:gesture_distance", Hyprlang::INT{200});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:gesture_prediction_ms", Hyprlang::FLOAT{0.F});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:gesture_positive", Hyprlang::INT{1});
+    HyprlandAPI::addConfigValue(PHANDLE, "plugin:hyprexpo:gesture_fingers", Hyprlang::INT{4});
+
+    HyprlandAPI::reloadConfig();
+
+    g_pThumbnailCache = makeUnique<CThumbnailCache>();
+    g_pTraceRecorder  = makeUnique<CTraceRecorder>();
+
+    if (g_renderPath == RENDER_PATH_HOOKED) {
+        Debug::log(LOG, "[he] rendering through renderWorkspace / addDamage / commit hooks");
+        return {"hyprexpo", "A plugin for an overview", "Vaxry", "1.0"};
     }
+
+    Debug::log(LOG, "[he] hook-free fallback: {}", fallbackReason);
+
+    // the commit hooks alone still keep tiles and thumbnails up to date
+    if (DAMAGESOURCES)
+        HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Running without render hooks (" + fallbackReason + ")", CHyprColor{1.0, 0.7, 0.2, 1.0}, 5000);
+    else
+        HyprlandAPI::addNotification(PHANDLE, "[hyprexpo] Running without hooks (" + fallbackReason + "), desktops won't update while the overview is open", CHyprColor{1.0, 0.7, 0.2, 1.0},
+                                     5000);
+
+    return {"hyprexpo", "A plugin for an overview (hook-free fallback)", "Vaxry", "1.0"};
 }
 
 APICALL EXPORT void PLUGIN_EXIT() {
-    pluginInitialized = false;
-    overviewActive = false;
-} 
\ No newline at end of file
+    g_pHyprRenderer->m_renderPass.removeAllOfType("COverviewPassElement");
+
+    g_overviews.clear();
+    g_pThumbnailCache.reset();
+    g_pTraceRecorder.reset();
+    g_pWorkspaceIndex.reset();
+    g_pFramebufferPool.reset();
+
+    removeRenderHooks();
+    removeDamageSourceHooks();
+}
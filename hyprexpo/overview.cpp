@@ -7,38 +7,89 @@
 #include <hyprland/src/config/ConfigManager.hpp>
 #include <hyprland/src/managers/AnimationManager.hpp>
 #include <hyprland/src/managers/input/InputManager.hpp>
+#include <hyprland/src/devices/IPointer.hpp>
 #include <hyprland/src/helpers/time/Time.hpp>
 #undef private
 #include "OverviewPassElement.hpp"
+#include "FramebufferPool.hpp"
+#include "ThumbnailCache.hpp"
+#include "Trace.hpp"
+#include "WorkspaceIndex.hpp"
+
+COverview* getOverviewFor(PHLMONITOR pMonitor) {
+    for (const auto& o : g_overviews) {
+        if (o->pMonitor == pMonitor)
+            return o.get();
+    }
+
+    return nullptr;
+}
+
+COverview* focusedOverview() {
+    return getOverviewFor(g_pCompositor->m_lastMonitor.lock());
+}
+
+void openOverview(PHLWORKSPACE startedOn, bool swipe) {
+    if (!startedOn || !startedOn->m_monitor)
+        return;
 
-static void damageMonitor(WP<Hyprutils::Animation::CBaseAnimatedVariable> thisptr) {
-    g_pOverview->damage();
+    // one overview per monitor, a new one replaces whatever was open there
+    std::erase_if(g_overviews, [&](const auto& o) { return o->pMonitor == startedOn->m_monitor; });
+    g_overviews.emplace_back(std::make_unique<COverview>(startedOn, swipe));
 }
 
-static void removeOverview(WP<Hyprutils::Animation::CBaseAnimatedVariable> thisptr) {
-    g_pOverview.reset();
+static void removeOverview(COverview* overview) {
+    std::erase_if(g_overviews, [overview](const auto& o) { return o.get() == overview; });
 }
 
 COverview::~COverview() {
     g_pHyprRenderer->makeEGLCurrent();
-    images.clear(); // otherwise we get a vram leak
+    for (auto& image : images) {
+        if (!image.fromCache)
+            g_pFramebufferPool->release(image.fb);
+    }
+    images.clear();
+    g_pFramebufferPool->release(atlas);
+
+    const auto& STATS = g_pFramebufferPool->m_stats;
+    Debug::log(LOG, "[he] fb pool: {} hits, {} misses, {} evictions, {} bytes pooled, {} bytes in use", STATS.hits, STATS.misses, STATS.evictions, STATS.bytesPooled,
+               STATS.bytesInUse);
+
+    if (g_pThumbnailCache) {
+        g_overviewStats.thumbnailVramSaved = g_pThumbnailCache->vramSaved();
+        Debug::log(LOG, "[he] thumbnail cache: {} bytes stored, {} uploads, {} bytes of VRAM saved", g_pThumbnailCache->m_stats.bytes, g_pThumbnailCache->m_stats.uploads,
+                   g_overviewStats.thumbnailVramSaved);
+    }
+
     g_pInputManager->unsetCursorImage();
     g_pHyprOpenGL->markBlurDirtyForMonitor(pMonitor.lock());
 }
 
 COverview::COverview(PHLWORKSPACE startedOn_, bool swipe_) : startedOn(startedOn_), swipe(swipe_) {
-    const auto PMONITOR = g_pCompositor->m_lastMonitor.lock();
+    openedAt = Time::steadyNow();
+
+    CScopedTrace traceOpen{"open"};
+
+    if (!g_pFramebufferPool)
+        g_pFramebufferPool = makeUnique<CFramebufferPool>();
+
+    const auto PMONITOR = startedOn->m_monitor.lock();
     pMonitor            = PMONITOR;
 
-    static auto* const* PCOLUMNS = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:columns")->getDataStaticPtr();
-    static auto* const* PGAPS    = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:gap_size")->getDataStaticPtr();
-    static auto* const* PCOL     = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:bg_col")->getDataStaticPtr();
-    static auto const*  PMETHOD  = (Hyprlang::STRING const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:workspace_method")->getDataStaticPtr();
+    static auto* const* PCOLUMNS     = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:columns")->getDataStaticPtr();
+    static auto* const* PGAPS        = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:gap_size")->getDataStaticPtr();
+    static auto* const* PCOL         = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:bg_col")->getDataStaticPtr();
+    static auto const*  PMETHOD      = (Hyprlang::STRING const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:workspace_method")->getDataStaticPtr();
+    static auto* const* PPROGRESSIVE = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:progressive_open")->getDataStaticPtr();
+    static auto* const* PPLACEHOLDER = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:placeholder_col")->getDataStaticPtr();
+    static auto* const* PCOUNT       = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:workspace_count")->getDataStaticPtr();
 
     SIDE_LENGTH = **PCOLUMNS;
     GAP_WIDTH   = **PGAPS;
     BG_COLOR    = **PCOL;
 
+    PLACEHOLDER_COLOR = **PPLACEHOLDER;
+
     // process the method
     bool     methodCenter  = true;
     int      methodStartID = pMonitor->activeWorkspaceID();
@@ -52,124 +103,84 @@ COverview::COverview(PHLWORKSPACE startedOn_, bool swipe_) : startedOn(startedOn
             methodStartID = pMonitor->activeWorkspaceID();
     }
 
-    images.resize(SIDE_LENGTH * SIDE_LENGTH);
+    CScopedTrace traceResolve{"open: resolve workspaces"};
 
-    if (methodCenter) {
-        int currentID = methodStartID;
-        int firstID   = currentID;
+    // more workspaces than fit on screen make the grid scroll vertically
+    images.resize(std::max((int64_t)**PCOUNT, (int64_t)SIDE_LENGTH * SIDE_LENGTH));
 
-        int backtracked = 0;
+    if (!g_pWorkspaceIndex)
+        g_pWorkspaceIndex = makeUnique<CWorkspaceIndex>();
 
-        for (size_t i = 1; i < images.size() / 2; ++i) {
-            currentID = getWorkspaceIDNameFromString("r-" + std::to_string(i)).id;
-            if (currentID >= firstID)
-                break;
+    const auto IDS = g_pWorkspaceIndex->slice(pMonitor.lock(), methodStartID, images.size(), methodCenter);
+    for (size_t i = 0; i < images.size() && i < IDS.size(); ++i) {
+        images[i].workspaceID = IDS[i];
+        tileIDs[IDS[i]]       = i;
+    }
 
-            backtracked++;
-            firstID = currentID;
-        }
+    traceResolve.finish();
 
-        for (size_t i = 0; i < (size_t)(SIDE_LENGTH * SIDE_LENGTH); ++i) {
-            auto& image = images[i];
-            currentID =
-                getWorkspaceIDNameFromString("r" + ((int64_t)i - backtracked < 0 ? std::to_string((int64_t)i - backtracked) : "+" + std::to_string((int64_t)i - backtracked))).id;
-            image.workspaceID = currentID;
-        }
-    } else {
-        int currentID         = methodStartID;
-        images[0].workspaceID = currentID;
+    g_pHyprRenderer->makeEGLCurrent();
 
-        auto PWORKSPACESTART = g_pCompositor->getWorkspaceByID(currentID);
-        if (!PWORKSPACESTART)
-            PWORKSPACESTART = CWorkspace::create(currentID, pMonitor.lock(), std::to_string(currentID));
+    int currentid = 0;
 
-        pMonitor->m_activeWorkspace = PWORKSPACESTART;
+    for (size_t i = 0; i < images.size(); ++i) {
+        auto& image = images[i];
 
-        for (size_t i = 1; i < (size_t)(SIDE_LENGTH * SIDE_LENGTH); ++i) {
-            auto& image       = images[i];
-            currentID         = getWorkspaceIDNameFromString("r+" + std::to_string(i)).id;
-            image.workspaceID = currentID;
-        }
+        image.pWorkspace = g_pCompositor->getWorkspaceByID(image.workspaceID);
 
-        pMonitor->m_activeWorkspace = startedOn;
+        if (image.pWorkspace && image.pWorkspace == startedOn)
+            currentid = i;
     }
 
-    g_pHyprRenderer->makeEGLCurrent();
+    // keep the current workspace's row in the middle of the viewport if we can
+    scrollRow = grid().scrollRowFor(currentid);
 
-    Vector2D tileSize       = pMonitor->m_size / SIDE_LENGTH;
-    Vector2D tileRenderSize = (pMonitor->m_size - Vector2D{GAP_WIDTH * pMonitor->m_scale, GAP_WIDTH * pMonitor->m_scale} * (SIDE_LENGTH - 1)) / SIDE_LENGTH;
-    CBox     monbox{0, 0, tileSize.x * 2, tileSize.y * 2};
+    CScopedTrace traceCapture{"open: capture tiles"};
 
-    if (!ENABLE_LOWRES)
-        monbox = {{0, 0}, pMonitor->m_pixelSize};
-
-    int          currentid = 0;
+    // nearest-first: the tile we zoom out of, then its neighbours, then the rest of the grid
+    std::vector<int> captureOrder;
+    captureOrder.reserve(images.size());
+    for (size_t i = 0; i < images.size(); ++i) {
+        captureOrder.emplace_back(i);
+    }
 
-    PHLWORKSPACE openSpecial = PMONITOR->m_activeSpecialWorkspace;
-    if (openSpecial)
-        PMONITOR->m_activeSpecialWorkspace.reset();
+    std::ranges::stable_sort(captureOrder, [GRID = grid(), currentid](int a, int b) { return GRID.tileDistance(a, currentid) < GRID.tileDistance(b, currentid); });
 
     g_pHyprRenderer->m_bBlockSurfaceFeedback = true;
 
-    startedOn->m_visible = false;
-
-    for (size_t i = 0; i < (size_t)(SIDE_LENGTH * SIDE_LENGTH); ++i) {
-        COverview::SWorkspaceImage& image = images[i];
-        image.fb.alloc(monbox.w, monbox.h, PMONITOR->m_output->state->state().drmFormat);
-
-        CRegion fakeDamage{0, 0, INT16_MAX, INT16_MAX};
-        g_pHyprRenderer->beginRender(PMONITOR, fakeDamage, RENDER_MODE_FULL_FAKE, nullptr, &image.fb);
-
-        g_pHyprOpenGL->clear(CHyprColor{0, 0, 0, 1.0});
-
-        const auto PWORKSPACE = g_pCompositor->getWorkspaceByID(image.workspaceID);
-
-        if (PWORKSPACE == startedOn)
-            currentid = i;
-
-        if (PWORKSPACE) {
-            image.pWorkspace          = PWORKSPACE;
-            PMONITOR->m_activeWorkspace = PWORKSPACE;
-            PWORKSPACE->startAnim(true, true, true);
-            PWORKSPACE->m_visible = true;
-
-            if (PWORKSPACE == startedOn)
-                PMONITOR->m_activeSpecialWorkspace = openSpecial;
-
-            g_pHyprRenderer->renderWorkspace(PMONITOR, PWORKSPACE, Time::steadyNow(), monbox);
-
-            PWORKSPACE->m_visible = false;
-            PWORKSPACE->startAnim(false, false, true);
+    for (const auto& id : captureOrder) {
+        // only what's on screen or a row away ever gets a framebuffer
+        if (!grid().isResident(id))
+            continue;
 
-            if (PWORKSPACE == startedOn)
-                PMONITOR->m_activeSpecialWorkspace.reset();
-        } else
-            g_pHyprRenderer->renderWorkspace(PMONITOR, PWORKSPACE, Time::steadyNow(), monbox);
+        // a fresh thumbnail needs no capture, a stale one is still better than a placeholder
+        if (id != currentid && applyCachedThumbnail(id))
+            continue;
 
-        image.box = {(i % SIDE_LENGTH) * tileRenderSize.x + (i % SIDE_LENGTH) * GAP_WIDTH, (i / SIDE_LENGTH) * tileRenderSize.y + (i / SIDE_LENGTH) * GAP_WIDTH, tileRenderSize.x,
-                     tileRenderSize.y};
+        if ((**PPROGRESSIVE && grid().tileDistance(id, currentid) > 1) || !grid().isVisible(id)) {
+            pendingCaptures.emplace_back(id);
+            continue;
+        }
 
-        g_pHyprOpenGL->m_renderData.blockScreenShader = true;
-        g_pHyprRenderer->endRender();
+        // the opened tile is what we zoom out of, so it needs full res
+        renderTile(id, captureBox(id != currentid));
     }
 
     g_pHyprRenderer->m_bBlockSurfaceFeedback = false;
 
-    PMONITOR->m_activeSpecialWorkspace = openSpecial;
-    PMONITOR->m_activeWorkspace        = startedOn;
-    startedOn->m_visible            = true;
-    startedOn->startAnim(true, true, true);
+    traceCapture.finish();
+
+    CScopedTrace traceAnimations{"open: animations"};
 
     // zoom on the current workspace.
     // const auto& TILE = images[std::clamp(currentid, 0, SIDE_LENGTH * SIDE_LENGTH)];
 
-    g_pAnimationManager->createAnimation(pMonitor->m_size * pMonitor->m_size / tileSize, size, g_pConfigManager->getAnimationPropertyConfig("windowsMove"), AVARDAMAGE_NONE);
-    g_pAnimationManager->createAnimation((-((pMonitor->m_size / (double)SIDE_LENGTH) * Vector2D{currentid % SIDE_LENGTH, currentid / SIDE_LENGTH}) * pMonitor->m_scale) *
-                                             (pMonitor->m_size / tileSize),
-                                         pos, g_pConfigManager->getAnimationPropertyConfig("windowsMove"), AVARDAMAGE_NONE);
+    g_pAnimationManager->createAnimation(grid().zoomedSize(pMonitor->m_size), size, g_pConfigManager->getAnimationPropertyConfig("windowsMove"), AVARDAMAGE_NONE);
+    g_pAnimationManager->createAnimation(grid().zoomedPos(currentid, pMonitor->m_size, pMonitor->m_scale), pos, g_pConfigManager->getAnimationPropertyConfig("windowsMove"),
+                                         AVARDAMAGE_NONE);
 
-    size->setUpdateCallback(damageMonitor);
-    pos->setUpdateCallback(damageMonitor);
+    size->setUpdateCallback([this](auto) { damage(); });
+    pos->setUpdateCallback([this](auto) { damage(); });
 
     if (!swipe) {
         *size = pMonitor->m_size;
@@ -180,12 +191,15 @@ COverview::COverview(PHLWORKSPACE startedOn_, bool swipe_) : startedOn(startedOn
 
     openedID = currentid;
 
+    traceAnimations.finish();
+
     g_pInputManager->setCursorImageUntilUnset("left_ptr");
 
     lastMousePosLocal = g_pInputManager->getMouseCoordsInternal() - pMonitor->m_position;
 
+    // with several overviews open, each one only handles input on its own monitor
     auto onCursorMove = [this](void* self, SCallbackInfo& info, std::any param) {
-        if (closing)
+        if (closing || g_pCompositor->getMonitorFromCursor() != pMonitor)
             return;
 
         info.cancelled    = true;
@@ -193,110 +207,252 @@ COverview::COverview(PHLWORKSPACE startedOn_, bool swipe_) : startedOn(startedOn
     };
 
     auto onCursorSelect = [this](void* self, SCallbackInfo& info, std::any param) {
-        if (closing)
+        if (closing || g_pCompositor->getMonitorFromCursor() != pMonitor)
             return;
 
         info.cancelled = true;
 
-        // get tile x,y
-        int x = lastMousePosLocal.x / pMonitor->m_size.x * SIDE_LENGTH;
-        int y = lastMousePosLocal.y / pMonitor->m_size.y * SIDE_LENGTH;
-
-        closeOnID = x + y * SIDE_LENGTH;
+        closeOnID = grid().tileAt(lastMousePosLocal, pMonitor->m_size);
 
         close();
     };
 
+    auto onScroll = [this](void* self, SCallbackInfo& info, std::any param) {
+        if (closing || g_pCompositor->getMonitorFromCursor() != pMonitor)
+            return;
+
+        info.cancelled = true;
+
+        const auto E = std::any_cast<IPointer::SAxisEvent>(std::any_cast<std::unordered_map<std::string, std::any>>(param).at("event"));
+        if (E.axis != WL_POINTER_AXIS_VERTICAL_SCROLL || size->isBeingAnimated())
+            return;
+
+        // one row per wheel notch, touchpads have to travel the same distance
+        scrollAccumulated += E.delta;
+        while (std::abs(scrollAccumulated) >= 15.0) {
+            const int DIR = scrollAccumulated > 0 ? 1 : -1;
+            scrollAccumulated -= DIR * 15.0;
+            scroll(DIR);
+        }
+    };
+
     mouseMoveHook = g_pHookSystem->hookDynamic("mouseMove", onCursorMove);
     touchMoveHook = g_pHookSystem->hookDynamic("touchMove", onCursorMove);
 
     mouseButtonHook = g_pHookSystem->hookDynamic("mouseButton", onCursorSelect);
     touchDownHook   = g_pHookSystem->hookDynamic("touchDown", onCursorSelect);
+
+    if (grid().maxScrollRow() > 0)
+        mouseAxisHook = g_pHookSystem->hookDynamic("mouseAxis", onScroll);
 }
 
 void COverview::selectHoveredWorkspace() {
     if (closing)
         return;
 
-    // get tile x,y
-    int x = lastMousePosLocal.x / pMonitor->m_size.x * SIDE_LENGTH;
-    int y = lastMousePosLocal.y / pMonitor->m_size.y * SIDE_LENGTH;
-    closeOnID = x + y * SIDE_LENGTH;
+    closeOnID = grid().tileAt(lastMousePosLocal, pMonitor->m_size);
 }
 
-void COverview::redrawID(int id, bool forcelowres) {
-    if (pMonitor->m_activeWorkspace != startedOn && !closing) {
-        // likely user changed.
-        onWorkspaceChange();
-    }
+SOverviewGrid COverview::grid() const {
+    return SOverviewGrid{.columns = SIDE_LENGTH, .tiles = images.size(), .scrollRow = scrollRow};
+}
 
-    blockOverviewRendering = true;
+void COverview::scroll(int rows) {
+    const int NEWROW = std::clamp(scrollRow + rows, 0, grid().maxScrollRow());
+    if (NEWROW == scrollRow)
+        return;
+
+    scrollRow = NEWROW;
 
     g_pHyprRenderer->makeEGLCurrent();
 
-    id = std::clamp(id, 0, SIDE_LENGTH * SIDE_LENGTH);
+    // the atlas only holds the viewport, start it over
+    g_pFramebufferPool->release(atlas);
+    atlas.reset();
 
-    Vector2D tileSize       = pMonitor->m_size / SIDE_LENGTH;
-    Vector2D tileRenderSize = (pMonitor->m_size - Vector2D{GAP_WIDTH, GAP_WIDTH} * (SIDE_LENGTH - 1)) / SIDE_LENGTH;
-    CBox     monbox{0, 0, tileSize.x * 2, tileSize.y * 2};
+    for (size_t i = 0; i < images.size(); ++i) {
+        auto& image = images[i];
 
-    if (!forcelowres && (size->value() != pMonitor->m_size || closing))
-        monbox = {{0, 0}, pMonitor->m_pixelSize};
+        if (!grid().isResident(i)) {
+            // out of reach, hand the fb back so memory stays bounded by the viewport
+            if (!image.fromCache)
+                g_pFramebufferPool->release(image.fb);
 
-    if (!ENABLE_LOWRES)
-        monbox = {{0, 0}, pMonitor->m_pixelSize};
+            image.fb.reset();
+            image.captured  = false;
+            image.dirty     = false;
+            image.fromCache = false;
+            continue;
+        }
 
-    auto& image = images[id];
+        if (image.captured) {
+            if (grid().isVisible(i))
+                blitToAtlas(i);
+            continue;
+        }
 
-    if (image.fb.m_size != monbox.size()) {
-        image.fb.release();
-        image.fb.alloc(monbox.w, monbox.h, pMonitor->m_output->state->state().drmFormat);
+        if (std::ranges::find(pendingCaptures, (int)i) != pendingCaptures.end())
+            continue;
+
+        if (!applyCachedThumbnail(i))
+            pendingCaptures.emplace_back(i);
     }
 
+    std::erase_if(pendingCaptures, [GRID = grid()](int id) { return !GRID.isResident(id); });
+    std::ranges::stable_sort(pendingCaptures, [GRID = grid()](int a, int b) { return GRID.isVisible(a) && !GRID.isVisible(b); });
+
+    damage();
+}
+
+CBox COverview::captureBox(bool lowres) const {
+    static auto* const* PLOWRES = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:lowres")->getDataStaticPtr();
+    static auto* const* PSCALE  = (Hyprlang::FLOAT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:lowres_scale")->getDataStaticPtr();
+
+    if (!lowres || !**PLOWRES)
+        return {{0, 0}, pMonitor->m_pixelSize};
+
+    const auto SIZE = (pMonitor->m_pixelSize / SIDE_LENGTH * std::max(**PSCALE, 0.1F)).floor();
+
+    return {{0, 0}, Vector2D{std::clamp(SIZE.x, 1.0, pMonitor->m_pixelSize.x), std::clamp(SIZE.y, 1.0, pMonitor->m_pixelSize.y)}};
+}
+
+void renderWorkspaceToFramebuffer(PHLMONITOR pMonitor, PHLWORKSPACE pWorkspace, CFramebuffer* fb, const CBox& monbox) {
+    const auto ACTIVE = pMonitor->m_activeWorkspace;
+
+    // blur samples the monitor-sized blur fb, which doesn't line up with a scaled down workspace. Low-res tiles
+    // are rendered as snapshots, which the renderer draws without blur. Tiles are small enough for that not to be noticeable.
+    const bool LOWRES   = monbox.size() != pMonitor->m_pixelSize;
+    const bool SNAPSHOT = g_pHyprRenderer->m_bRenderingSnapshot;
+    if (LOWRES)
+        g_pHyprRenderer->m_bRenderingSnapshot = true;
+
     CRegion fakeDamage{0, 0, INT16_MAX, INT16_MAX};
-    g_pHyprRenderer->beginRender(pMonitor.lock(), fakeDamage, RENDER_MODE_FULL_FAKE, nullptr, &image.fb);
+    g_pHyprRenderer->beginRender(pMonitor, fakeDamage, RENDER_MODE_FULL_FAKE, nullptr, fb);
 
     g_pHyprOpenGL->clear(CHyprColor{0, 0, 0, 1.0});
 
-    const auto   PWORKSPACE = image.pWorkspace;
-
     PHLWORKSPACE openSpecial = pMonitor->m_activeSpecialWorkspace;
     if (openSpecial)
         pMonitor->m_activeSpecialWorkspace.reset();
 
-    startedOn->m_visible = false;
+    ACTIVE->m_visible = false;
 
-    if (PWORKSPACE) {
-        pMonitor->m_activeWorkspace = PWORKSPACE;
-        PWORKSPACE->startAnim(true, true, true);
-        PWORKSPACE->m_visible = true;
+    if (pWorkspace) {
+        pMonitor->m_activeWorkspace = pWorkspace;
+        pWorkspace->startAnim(true, true, true);
+        pWorkspace->m_visible = true;
 
-        if (PWORKSPACE == startedOn)
+        if (pWorkspace == ACTIVE)
             pMonitor->m_activeSpecialWorkspace = openSpecial;
 
-        g_pHyprRenderer->renderWorkspace(pMonitor.lock(), PWORKSPACE, Time::steadyNow(), monbox);
+        g_pHyprRenderer->renderWorkspace(pMonitor, pWorkspace, Time::steadyNow(), monbox);
 
-        PWORKSPACE->m_visible = false;
-        PWORKSPACE->startAnim(false, false, true);
+        pWorkspace->m_visible = false;
+        pWorkspace->startAnim(false, false, true);
 
-        if (PWORKSPACE == startedOn)
+        if (pWorkspace == ACTIVE)
             pMonitor->m_activeSpecialWorkspace.reset();
     } else
-        g_pHyprRenderer->renderWorkspace(pMonitor.lock(), PWORKSPACE, Time::steadyNow(), monbox);
+        g_pHyprRenderer->renderWorkspace(pMonitor, pWorkspace, Time::steadyNow(), monbox);
 
     g_pHyprOpenGL->m_renderData.blockScreenShader = true;
     g_pHyprRenderer->endRender();
 
+    // a queued pre-blur may still have run into the small fb, so the next real frame redoes it
+    if (LOWRES) {
+        g_pHyprRenderer->m_bRenderingSnapshot = SNAPSHOT;
+        g_pHyprOpenGL->markBlurDirtyForMonitor(pMonitor);
+    }
+
     pMonitor->m_activeSpecialWorkspace = openSpecial;
-    pMonitor->m_activeWorkspace        = startedOn;
-    startedOn->m_visible            = true;
-    startedOn->startAnim(true, true, true);
+    pMonitor->m_activeWorkspace        = ACTIVE;
+    ACTIVE->m_visible                  = true;
+    ACTIVE->startAnim(true, true, true);
+}
+
+void COverview::renderTile(int id, const CBox& monbox) {
+    static auto* const* PLOWRES = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:lowres")->getDataStaticPtr();
+
+    CScopedTrace        trace{"renderTile", id};
+
+    auto&               image = images[id];
+
+    // thumbnails handed out by the cache are shared with it, never draw into those
+    if (!image.fb || image.fromCache || image.fb->m_size != monbox.size()) {
+        CScopedTrace traceAlloc{"acquire fb", id};
+
+        if (!image.fromCache)
+            g_pFramebufferPool->release(image.fb);
+        image.fb        = g_pFramebufferPool->acquire(monbox.size(), pMonitor->m_output->state->state().drmFormat);
+        image.fromCache = false;
+    }
+
+    CScopedTrace traceRender{"renderWorkspace", id};
+    renderWorkspaceToFramebuffer(pMonitor.lock(), image.pWorkspace, image.fb.get(), monbox);
+    traceRender.finish();
+
+    // mipmaps keep the tile from aliasing while it's scaled down during the zoom
+    const auto TEX = image.fb->getTexture();
+    if (**PLOWRES) {
+        glBindTexture(GL_TEXTURE_2D, TEX->m_texID);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        TEX->m_minFilter = GL_LINEAR_MIPMAP_LINEAR;
+    } else
+        TEX->m_minFilter = GL_LINEAR;
+
+    image.captured = true;
+    image.dirty    = false;
+
+    blitToAtlas(id);
+}
+
+bool COverview::applyCachedThumbnail(int id) {
+    if (!g_pThumbnailCache)
+        return false;
+
+    auto&      image = images[id];
+
+    const auto THUMB = g_pThumbnailCache->get(image.workspaceID);
+    if (!THUMB)
+        return false;
+
+    image.fb        = THUMB->fb;
+    image.fromCache = true;
+    image.captured  = true;
+
+    blitToAtlas(id);
+
+    return !THUMB->stale;
+}
+
+void COverview::redrawID(int id, bool forcelowres) {
+    CScopedTrace trace{"redrawID", id};
+
+    if (pMonitor->m_activeWorkspace != startedOn && !closing) {
+        // likely user changed.
+        onWorkspaceChange();
+    }
+
+    blockOverviewRendering = true;
+
+    g_pHyprRenderer->makeEGLCurrent();
+
+    id = std::clamp(id, 0, (int)images.size() - 1);
+
+    // full res while zooming, tile res once the grid has settled
+    renderTile(id, captureBox(forcelowres || (size->value() == pMonitor->m_size && !closing)));
 
     blockOverviewRendering = false;
 }
 
 void COverview::redrawAll(bool forcelowres) {
-    for (size_t i = 0; i < (size_t)(SIDE_LENGTH * SIDE_LENGTH); ++i) {
+    pendingCaptures.clear();
+
+    for (size_t i = 0; i < images.size(); ++i) {
+        if (!grid().isResident(i))
+            continue;
+
         redrawID(i, forcelowres);
     }
 }
@@ -307,40 +463,84 @@ void COverview::damage() {
     blockDamageReporting = false;
 }
 
-void COverview::onDamageReported() {
-    damageDirty = true;
+void COverview::damageTiles(const std::vector<int>& ids) {
+    // while the grid moves every tile lands somewhere else anyway
+    if (!settled()) {
+        damage();
+        return;
+    }
 
-    Vector2D    SIZE = size->value();
+    blockDamageReporting = true;
+    for (const auto& id : ids) {
+        if (!grid().isVisible(id))
+            continue;
 
-    Vector2D    tileSize       = (SIZE / SIDE_LENGTH);
-    Vector2D    tileRenderSize = (SIZE - Vector2D{GAP_WIDTH, GAP_WIDTH} * (SIDE_LENGTH - 1)) / SIDE_LENGTH;
-    // const auto& TILE           = images[std::clamp(openedID, 0, SIDE_LENGTH * SIDE_LENGTH)];
-    CBox        texbox         = CBox{(openedID % SIDE_LENGTH) * tileRenderSize.x + (openedID % SIDE_LENGTH) * GAP_WIDTH,
-                       (openedID / SIDE_LENGTH) * tileRenderSize.y + (openedID / SIDE_LENGTH) * GAP_WIDTH, tileRenderSize.x, tileRenderSize.y}
-                      .translate(pMonitor->m_position);
+        // a pixel of slack for the rounding the atlas blit does
+        g_pHyprRenderer->damageBox(grid().tileBox(id, pMonitor->m_size, GAP_WIDTH).translate(pMonitor->m_position).expand(1));
+    }
+    blockDamageReporting = false;
+}
 
-    damage();
+bool COverview::settled() const {
+    return atlas && !closing && !size->isBeingAnimated() && size->value() == pMonitor->m_size;
+}
+
+void COverview::onWindowDamaged(PHLWINDOW pWindow) {
+    if (!pWindow->m_isMapped || !pWindow->m_workspace)
+        return;
+
+    // all workspaces share the monitor's coords, so only the window itself can tell which tile it's on.
+    // an open special workspace is drawn into the tile of the one it's open over.
+    auto ws = pWindow->m_workspace;
+    if (ws->m_isSpecialWorkspace) {
+        if (ws != pMonitor->m_activeSpecialWorkspace || !pMonitor->m_activeWorkspace)
+            return;
+
+        ws = pMonitor->m_activeWorkspace;
+    }
+
+    const auto IT = tileIDs.find(ws->m_id);
+    if (IT == tileIDs.end())
+        return;
+
+    auto& image       = images[IT->second];
+    image.dirty       = true;
+    image.lastDamaged = Time::steadyNow();
 
-    blockDamageReporting = true;
-    g_pHyprRenderer->damageBox(texbox);
-    blockDamageReporting = false;
     g_pCompositor->scheduleFrameForMonitor(pMonitor.lock());
 }
 
+bool COverview::onDamageReported(const CRegion& region, PHLWINDOW source) {
+    // the cursor, layers and notifications are drawn on top of the overview, their damage has to reach the monitor as is
+    if (!source)
+        return false;
+
+    // a window's damage was turned into a dirty tile by onWindowDamaged, once the grid has settled
+    // that tile damages just its own box after onPreRender redrew it
+    if (!settled())
+        damage();
+
+    return true;
+}
+
 void COverview::close() {
     if (closing)
         return;
 
-    const int   ID = closeOnID == -1 ? openedID : closeOnID;
+    CScopedTrace trace{"close"};
+
+    const int ID = std::clamp(closeOnID == -1 ? openedID : closeOnID, 0, (int)images.size() - 1);
 
-    const auto& TILE = images[std::clamp(ID, 0, SIDE_LENGTH * SIDE_LENGTH)];
+    // without a selection the opened tile may have been scrolled away, it has to be drawn for the zoom to land on it
+    if (!grid().isVisible(ID))
+        scroll(grid().scrollRowFor(ID) - scrollRow);
 
-    Vector2D    tileSize = (pMonitor->m_size / SIDE_LENGTH);
+    const auto& TILE = images[ID];
 
-    *size = pMonitor->m_size * pMonitor->m_size / tileSize;
-    *pos  = (-((pMonitor->m_size / (double)SIDE_LENGTH) * Vector2D{ID % SIDE_LENGTH, ID / SIDE_LENGTH}) * pMonitor->m_scale) * (pMonitor->m_size / tileSize);
+    *size = grid().zoomedSize(pMonitor->m_size);
+    *pos  = grid().zoomedPos(ID, pMonitor->m_size, pMonitor->m_scale);
 
-    size->setCallbackOnEnd(removeOverview);
+    size->setCallbackOnEnd([this](auto) { removeOverview(this); });
 
     closing = true;
 
@@ -366,10 +566,107 @@ void COverview::close() {
 }
 
 void COverview::onPreRender() {
-    if (damageDirty) {
-        damageDirty = false;
-        redrawID(closing ? (closeOnID == -1 ? openedID : closeOnID) : openedID);
+    static auto* const* PBUDGET = (Hyprlang::FLOAT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:capture_budget_ms")->getDataStaticPtr();
+    static auto* const* PLIVE   = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:live")->getDataStaticPtr();
+
+    if (swipeInput.pending && !swipeWasCommenced)
+        applySwipe(true);
+
+    const int           FOCUSED = std::clamp(closing ? (closeOnID == -1 ? openedID : closeOnID) : openedID, 0, (int)images.size() - 1);
+
+    // live tiles only refresh once the grid has settled, the zoom has enough to do
+    const bool LIVE = **PLIVE && size->value() == pMonitor->m_size && !closing;
+
+    // round-robin from the last redrawn tile, so one busy tile can't starve the others
+    std::vector<int> dirty;
+    for (size_t i = 1; i <= images.size(); ++i) {
+        const int ID = (lastRedrawnID + i) % images.size();
+        if (ID != FOCUSED && images[ID].captured && (images[ID].dirty || (LIVE && grid().isVisible(ID))))
+            dirty.emplace_back(ID);
     }
+
+    // live: damaged tiles first, most recently damaged first. Ties keep the round-robin order.
+    if (LIVE)
+        std::ranges::stable_sort(dirty, [this](int a, int b) {
+            if (images[a].dirty != images[b].dirty)
+                return images[a].dirty;
+            return images[a].lastDamaged > images[b].lastDamaged;
+        });
+
+    const bool FOCUSEDDIRTY = images[FOCUSED].dirty && images[FOCUSED].captured;
+
+    if (!FOCUSEDDIRTY && dirty.empty() && pendingCaptures.empty())
+        return;
+
+    if (pMonitor->m_activeWorkspace != startedOn && !closing) {
+        // likely user changed.
+        onWorkspaceChange();
+        return;
+    }
+
+    const auto BEGIN      = Time::steadyNow();
+    const auto OVERBUDGET = [&BEGIN]() { return std::chrono::duration<float, std::milli>(Time::steadyNow() - BEGIN).count() >= **PBUDGET; };
+
+    blockOverviewRendering = true;
+
+    g_pHyprRenderer->makeEGLCurrent();
+
+    // full res while zooming, tile res once the grid has settled
+    const auto DIRTYBOX = captureBox(size->value() == pMonitor->m_size && !closing);
+
+    std::vector<int> redrawnIDs;
+
+    // the tile we are zoomed on is always kept up to date
+    if (FOCUSEDDIRTY) {
+        renderTile(FOCUSED, DIRTYBOX);
+        redrawnIDs.emplace_back(FOCUSED);
+    }
+
+    // always make progress on placeholders, even if a single capture blows the budget
+    if (!pendingCaptures.empty()) {
+        const auto PENDINGBOX = captureBox(true);
+
+        g_pHyprRenderer->m_bBlockSurfaceFeedback = true;
+
+        do {
+            renderTile(pendingCaptures.front(), PENDINGBOX);
+            redrawnIDs.emplace_back(pendingCaptures.front());
+            pendingCaptures.pop_front();
+        } while (!pendingCaptures.empty() && !OVERBUDGET());
+
+        g_pHyprRenderer->m_bBlockSurfaceFeedback = false;
+    }
+
+    // live: as many tiles as the rest of the budget fits at the measured cost, capped at half a frame so we keep up with the refresh rate
+    size_t maxTiles = dirty.size();
+    if (LIVE) {
+        const float FRAMEMS  = 1000.F / std::max(pMonitor->m_refreshRate, 1.F);
+        // the focused tile and placeholders may have used it all up already, the floor of one tile still applies then
+        const float BUDGETMS = std::max(std::min(**PBUDGET, FRAMEMS / 2.F) - std::chrono::duration<float, std::milli>(Time::steadyNow() - BEGIN).count(), 0.F);
+        maxTiles             = tileCostMs > 0.F ? std::max((size_t)(BUDGETMS / tileCostMs), (size_t)1) : 1;
+    }
+
+    size_t redrawn = 0;
+    for (const auto& id : dirty) {
+        if (redrawn >= maxTiles || (OVERBUDGET() && !(LIVE && redrawn == 0)))
+            break;
+
+        const auto TILEBEGIN = Time::steadyNow();
+
+        renderTile(id, DIRTYBOX);
+        redrawnIDs.emplace_back(id);
+        lastRedrawnID = id;
+        redrawn++;
+
+        if (LIVE) {
+            const float COST = std::chrono::duration<float, std::milli>(Time::steadyNow() - TILEBEGIN).count();
+            tileCostMs       = tileCostMs > 0.F ? tileCostMs * 0.9F + COST * 0.1F : COST;
+        }
+    }
+
+    blockOverviewRendering = false;
+
+    damageTiles(redrawnIDs);
 }
 
 void COverview::onWorkspaceChange() {
@@ -378,80 +675,183 @@ void COverview::onWorkspaceChange() {
     else
         startedOn = pMonitor->m_activeWorkspace;
 
-    for (size_t i = 0; i < (size_t)(SIDE_LENGTH * SIDE_LENGTH); ++i) {
-        if (images[i].workspaceID != pMonitor->activeWorkspaceID())
-            continue;
-
-        openedID = i;
-        break;
-    }
+    if (const auto IT = tileIDs.find(pMonitor->activeWorkspaceID()); IT != tileIDs.end())
+        openedID = IT->second;
 
     closeOnID = openedID;
     close();
 }
 
 void COverview::render() {
-    g_pHyprRenderer->m_renderPass.add(makeShared<COverviewPassElement>());
+    g_pHyprRenderer->m_renderPass.add(makeShared<COverviewPassElement>(this));
 }
 
-void COverview::fullRender() {
-    const auto GAPSIZE = (closing ? (1.0 - size->getPercent()) : size->getPercent()) * GAP_WIDTH;
+void COverview::fullRender(const CRegion& damage) {
+    CScopedTrace trace{"fullRender"};
+
+    if (!firstFrameRendered) {
+        firstFrameRendered = true;
+
+        const auto NOW                         = Time::steadyNow();
+        g_overviewStats.lastTimeToFirstFrameMs = std::chrono::duration<float, std::milli>(NOW - openedAt).count();
+        Debug::log(LOG, "[he] overview time to first frame: {:.2f}ms ({} tiles deferred)", g_overviewStats.lastTimeToFirstFrameMs, pendingCaptures.size());
+
+        if (g_pTraceRecorder && g_pTraceRecorder->enabled())
+            g_pTraceRecorder->record("open: time to first frame", openedAt, NOW, -1);
+    }
+
+    const auto GAPSIZE = animatedGap(GAP_WIDTH, size->getPercent(), closing);
 
     if (pMonitor->m_activeWorkspace != startedOn && !closing) {
         // likely user changed.
         onWorkspaceChange();
     }
 
-    Vector2D SIZE = size->value();
-
-    Vector2D tileSize       = (SIZE / SIDE_LENGTH);
-    Vector2D tileRenderSize = (SIZE - Vector2D{GAPSIZE, GAPSIZE} * (SIDE_LENGTH - 1)) / SIDE_LENGTH;
+    // once the grid has settled it's exactly what the atlas holds, so one draw covers every tile.
+    // damage is limited to the tiles redrawn since the last frame, the rest of the atlas isn't touched.
+    if (settled()) {
+        g_pHyprOpenGL->renderTextureInternalWithDamage(atlas->getTexture(), CBox{{}, pMonitor->m_pixelSize}, 1.0, damage);
+        g_overviewStats.lastFrameDrawCalls = 1;
+        return;
+    }
 
     g_pHyprOpenGL->clear(BG_COLOR.stripA());
 
-    for (size_t y = 0; y < (size_t)SIDE_LENGTH; ++y) {
-        for (size_t x = 0; x < (size_t)SIDE_LENGTH; ++x) {
-            CBox texbox = {x * tileRenderSize.x + x * GAPSIZE, y * tileRenderSize.y + y * GAPSIZE, tileRenderSize.x, tileRenderSize.y};
-            texbox.scale(pMonitor->m_scale).translate(pos->value());
-            texbox.round();
-            CRegion damage{0, 0, INT16_MAX, INT16_MAX};
-            g_pHyprOpenGL->renderTextureInternalWithDamage(images[x + y * SIDE_LENGTH].fb.getTexture(), texbox, 1.0, damage);
+    g_overviewStats.lastFrameDrawCalls = 0;
+
+    for (size_t i = 0; i < images.size(); ++i) {
+        if (!grid().isResident(i))
+            continue;
+
+        CBox texbox = grid().tileBox(i, size->value(), GAPSIZE);
+        texbox.scale(pMonitor->m_scale).translate(pos->value());
+        texbox.round();
+
+        g_overviewStats.lastFrameDrawCalls++;
+
+        if (!images[i].captured) {
+            g_pHyprOpenGL->renderRect(texbox, PLACEHOLDER_COLOR, 0);
+            continue;
         }
+
+        g_pHyprOpenGL->renderTextureInternalWithDamage(images[i].fb->getTexture(), texbox, 1.0, damage);
     }
 }
 
-static float lerp(const float& from, const float& to, const float perc) {
-    return (to - from) * perc + from;
+void COverview::initAtlas() {
+    atlas = g_pFramebufferPool->acquire(pMonitor->m_pixelSize, pMonitor->m_output->state->state().drmFormat);
+
+    CRegion fullDamage{0, 0, INT16_MAX, INT16_MAX};
+    g_pHyprRenderer->beginRender(pMonitor.lock(), fullDamage, RENDER_MODE_FULL_FAKE, nullptr, atlas.get());
+
+    g_pHyprOpenGL->clear(BG_COLOR.stripA());
+
+    for (size_t i = 0; i < images.size(); ++i) {
+        if (!grid().isVisible(i))
+            continue;
+
+        CBox texbox = grid().tileBox(i, pMonitor->m_size, GAP_WIDTH);
+        texbox.scale(pMonitor->m_scale).round();
+        g_pHyprOpenGL->renderRect(texbox, PLACEHOLDER_COLOR, 0);
+    }
+
+    g_pHyprOpenGL->m_renderData.blockScreenShader = true;
+    g_pHyprRenderer->endRender();
 }
 
-static Vector2D lerp(const Vector2D& from, const Vector2D& to, const float perc) {
-    return Vector2D{lerp(from.x, to.x, perc), lerp(from.y, to.y, perc)};
+void COverview::blitToAtlas(int id) {
+    if (!grid().isVisible(id))
+        return;
+
+    if (!atlas)
+        initAtlas();
+
+    CBox texbox = grid().tileBox(id, pMonitor->m_size, GAP_WIDTH);
+    texbox.scale(pMonitor->m_scale).round();
+
+    CRegion tileDamage{texbox};
+    g_pHyprRenderer->beginRender(pMonitor.lock(), tileDamage, RENDER_MODE_FULL_FAKE, nullptr, atlas.get());
+
+    g_pHyprOpenGL->renderTextureInternalWithDamage(images[id].fb->getTexture(), texbox, 1.0, tileDamage);
+
+    g_pHyprOpenGL->m_renderData.blockScreenShader = true;
+    g_pHyprRenderer->endRender();
 }
 
 void COverview::onSwipeUpdate(double delta) {
     if (swipeWasCommenced)
         return;
 
+    // touchpads can send several events per frame, only the latest one gets applied in onPreRender
+    const auto NOW = Time::steadyNow();
+
+    if (swipeInput.events > 0) {
+        const float DT = std::chrono::duration<float, std::milli>(NOW - swipeInput.lastEvent).count();
+        if (DT > 0.F)
+            swipeInput.velocity = swipeInput.velocity * 0.5 + (delta - swipeInput.delta) / DT * 0.5;
+    }
+
+    if (!swipeInput.pending)
+        swipeInput.firstPending = NOW;
+
+    swipeInput.pending   = true;
+    swipeInput.delta     = delta;
+    swipeInput.lastEvent = NOW;
+    swipeInput.events++;
+
+    damage();
+}
+
+void COverview::applySwipe(bool predict) {
     static auto* const* PDISTANCE = (Hyprlang::INT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:gesture_distance")->getDataStaticPtr();
+    static auto* const* PHORIZON  = (Hyprlang::FLOAT* const*)HyprlandAPI::getConfigValue(PHANDLE, "plugin:hyprexpo:gesture_prediction_ms")->getDataStaticPtr();
+
+    if (swipeInput.pending) {
+        const float LATENCY = std::chrono::duration<float, std::milli>(Time::steadyNow() - swipeInput.firstPending).count();
+        swipeInput.latencySumMs += LATENCY;
+        swipeInput.latencyMaxMs = std::max(swipeInput.latencyMaxMs, LATENCY);
+        swipeInput.frames++;
+    }
 
-    const float         PERC = 1.0 - std::clamp(delta / (double)**PDISTANCE, 0.0, 1.0);
+    // how far off the last guess was from where the finger actually went
+    if (swipeInput.predicted) {
+        swipeInput.errorSum += std::abs(swipeInput.delta - swipeInput.lastTarget);
+        swipeInput.predictions++;
+    }
 
-    Vector2D            tileSize = (pMonitor->m_size / SIDE_LENGTH);
+    // extrapolate to roughly when this frame hits the screen
+    double target = swipeInput.delta;
+    if (predict && **PHORIZON > 0.F)
+        target += swipeInput.velocity * **PHORIZON;
 
-    const auto          SIZEMAX = pMonitor->m_size * pMonitor->m_size / tileSize;
-    const auto          POSMAX =
-        (-((pMonitor->m_size / (double)SIDE_LENGTH) * Vector2D{openedID % SIDE_LENGTH, openedID / SIDE_LENGTH}) * pMonitor->m_scale) * (pMonitor->m_size / tileSize);
+    swipeInput.pending    = false;
+    swipeInput.predicted  = predict && **PHORIZON > 0.F;
+    swipeInput.lastTarget = target;
 
-    const auto SIZEMIN = pMonitor->m_size;
-    const auto POSMIN  = Vector2D{0, 0};
+    const float PERC    = swipeProgress(target, **PDISTANCE);
+
+    const auto  SIZEMAX = grid().zoomedSize(pMonitor->m_size);
+    const auto  POSMAX  = grid().zoomedPos(openedID, pMonitor->m_size, pMonitor->m_scale);
+
+    const auto  SIZEMIN = pMonitor->m_size;
+    const auto  POSMIN  = Vector2D{0, 0};
 
     size->setValueAndWarp(lerp(SIZEMIN, SIZEMAX, PERC));
     pos->setValueAndWarp(lerp(POSMIN, POSMAX, PERC));
 }
 
 void COverview::onSwipeEnd() {
+    // decide on where the finger really is, not on a prediction
+    if (swipeInput.events > 0 && !swipeWasCommenced) {
+        applySwipe(false);
+
+        Debug::log(LOG, "[he] swipe: {} events over {} frames, input to apply {:.2f}ms avg {:.2f}ms max, prediction error {:.2f} avg", swipeInput.events, swipeInput.frames,
+                   swipeInput.frames ? swipeInput.latencySumMs / swipeInput.frames : 0.F, swipeInput.latencyMaxMs,
+                   swipeInput.predictions ? swipeInput.errorSum / swipeInput.predictions : 0.0);
+    }
+
     const auto SIZEMIN = pMonitor->m_size;
-    const auto SIZEMAX = pMonitor->m_size * pMonitor->m_size / (pMonitor->m_size / SIDE_LENGTH);
+    const auto SIZEMAX = grid().zoomedSize(pMonitor->m_size);
     const auto PERC    = (size->value() - SIZEMIN).x / (SIZEMAX - SIZEMIN).x;
     if (PERC > 0.5) {
         close();
@@ -3,18 +3,29 @@
 #define WLR_USE_UNSTABLE
 
 #include "globals.hpp"
+#include "OverviewLayout.hpp"
 #include <hyprland/src/desktop/DesktopTypes.hpp>
 #include <hyprland/src/render/Framebuffer.hpp>
 #include <hyprland/src/helpers/AnimatedVariable.hpp>
 #include <hyprland/src/managers/HookSystemManager.hpp>
+#include <hyprland/src/helpers/time/Time.hpp>
 #include <vector>
-
-// saves on resources, but is a bit broken rn with blur.
-// hyprland's fault, but cba to fix.
-constexpr bool ENABLE_LOWRES = false;
+#include <deque>
+#include <unordered_map>
 
 class CMonitor;
 
+struct SOverviewStats {
+    // ms between the open request and the first composited overview frame
+    float  lastTimeToFirstFrameMs = 0.F;
+    // draws the last overview frame took to compose the grid
+    size_t lastFrameDrawCalls = 0;
+    // VRAM not spent on thumbnails thanks to keeping them in system memory, as of the last close
+    size_t thumbnailVramSaved = 0;
+};
+
+inline SOverviewStats g_overviewStats;
+
 class COverview {
   public:
     COverview(PHLWORKSPACE startedOn_, bool swipe = false);
@@ -22,7 +33,13 @@ class COverview {
 
     void render();
     void damage();
-    void onDamageReported();
+    // damages only the boxes of the given tiles once the grid has settled, the whole monitor otherwise
+    void damageTiles(const std::vector<int>& ids);
+    // a window's contents or geometry changed, marks the tile of its workspace dirty
+    void onWindowDamaged(PHLWINDOW pWindow);
+    // source is the window being committed or damaged, if any. False if the damage isn't any tile's,
+    // the caller then lets it through to the monitor.
+    bool onDamageReported(const CRegion& region, PHLWINDOW source);
     void onPreRender();
 
     void onSwipeUpdate(double delta);
@@ -38,31 +55,65 @@ class COverview {
     PHLMONITORREF pMonitor;
 
   private:
-    void       redrawID(int id, bool forcelowres = false);
-    void       redrawAll(bool forcelowres = false);
-    void       onWorkspaceChange();
-    void       fullRender();
+    void          redrawID(int id, bool forcelowres = false);
+    void          redrawAll(bool forcelowres = false);
+    void          renderTile(int id, const CBox& monbox);
+    bool          applyCachedThumbnail(int id);
+    CBox          captureBox(bool lowres) const;
+    // the grid as it is laid out right now
+    SOverviewGrid grid() const;
+    // zoomed out, not animating and drawn straight from the atlas
+    bool          settled() const;
+    void          scroll(int rows);
+    // applies the latest swipe position, extrapolated by gesture_prediction_ms if predict is set
+    void          applySwipe(bool predict);
+    void          onWorkspaceChange();
+    void          fullRender(const CRegion& damage);
+    void          initAtlas();
+    void          blitToAtlas(int id);
 
     int        SIDE_LENGTH = 3;
     int        GAP_WIDTH   = 5;
     CHyprColor BG_COLOR    = CHyprColor{0.1, 0.1, 0.1, 1.0};
-
-    bool       damageDirty = false;
+    CHyprColor PLACEHOLDER_COLOR = CHyprColor{0.12, 0.12, 0.12, 1.0};
 
     struct SWorkspaceImage {
-        CFramebuffer fb;
-        int64_t      workspaceID = -1;
-        PHLWORKSPACE pWorkspace;
-        CBox         box;
+        SP<CFramebuffer> fb;
+        int64_t          workspaceID = -1;
+        PHLWORKSPACE     pWorkspace;
+        bool             captured  = false;
+        bool             dirty     = false;
+        bool             fromCache = false;
+        Time::steady_tp  lastDamaged;
     };
 
     Vector2D                     lastMousePosLocal = Vector2D{};
 
-    int                          openedID  = -1;
-    int                          closeOnID = -1;
+    int                          openedID      = -1;
+    int                          closeOnID     = -1;
+    int                          lastRedrawnID = 0;
+
+    // running average of a settled tile redraw, sizes the live refresh batch
+    float                        tileCostMs = 0.F;
+
+    // first grid row in the viewport, only ever non-zero with more workspaces than fit
+    int                          scrollRow         = 0;
+    double                       scrollAccumulated = 0;
 
     std::vector<SWorkspaceImage> images;
 
+    // workspace id -> index in images
+    std::unordered_map<WORKSPACEID, int> tileIDs;
+
+    // every tile at its settled on-screen spot, gaps included
+    SP<CFramebuffer>             atlas;
+
+    // tiles still showing a placeholder, nearest to the opened one first
+    std::deque<int>              pendingCaptures;
+
+    Time::steady_tp              openedAt;
+    bool                         firstFrameRendered = false;
+
     PHLWORKSPACE                 startedOn;
 
     PHLANIMVAR<Vector2D>         size;
@@ -74,11 +125,40 @@ class COverview {
     SP<HOOK_CALLBACK_FN>         mouseButtonHook;
     SP<HOOK_CALLBACK_FN>         touchMoveHook;
     SP<HOOK_CALLBACK_FN>         touchDownHook;
+    SP<HOOK_CALLBACK_FN>         mouseAxisHook;
 
     bool                         swipe             = false;
     bool                         swipeWasCommenced = false;
 
+    struct {
+        bool            pending    = false;
+        bool            predicted  = false;
+        double          delta      = 0;
+        double          velocity   = 0; // delta per ms
+        double          lastTarget = 0;
+        Time::steady_tp lastEvent;
+        Time::steady_tp firstPending;
+
+        // for tuning the prediction, logged when the swipe ends
+        size_t          events       = 0;
+        size_t          frames       = 0;
+        size_t          predictions  = 0;
+        float           latencySumMs = 0.F;
+        float           latencyMaxMs = 0.F;
+        double          errorSum     = 0;
+    } swipeInput;
+
     friend class COverviewPassElement;
 };
 
-inline std::unique_ptr<COverview> g_pOverview;
+inline std::vector<std::unique_ptr<COverview>> g_overviews;
+
+// the overview open on pMonitor, nullptr if there is none
+COverview* getOverviewFor(PHLMONITOR pMonitor);
+// the overview open on the focused monitor
+COverview* focusedOverview();
+// opens an overview on startedOn's monitor, replacing one already open there
+void openOverview(PHLWORKSPACE startedOn, bool swipe = false);
+
+// renders pWorkspace into fb as if it was the active workspace on pMonitor
+void renderWorkspaceToFramebuffer(PHLMONITOR pMonitor, PHLWORKSPACE pWorkspace, CFramebuffer* fb, const CBox& monbox);
@@ -0,0 +1,74 @@
+#include "../OverviewLayout.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+// Cost of the overview's hot paths for grids from 2x2 to 20x20, each with as many workspaces as fit
+// and with four times that, scrolled to the middle. Build with optimizations for meaningful numbers.
+
+static volatile double sink = 0;
+
+template <typename F>
+static double nsPerRun(size_t runs, F&& fn) {
+    const auto BEGIN = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < runs; ++i) {
+        fn(i);
+    }
+
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - BEGIN).count() / runs;
+}
+
+static void benchGrid(int columns, size_t tiles) {
+    const Vector2D MONITOR = {2560, 1440};
+
+    SOverviewGrid  grid{.columns = columns, .tiles = tiles};
+    grid.scrollRow = grid.maxScrollRow() / 2;
+
+    // one animated frame: the gap and the box of every resident tile
+    const double FRAME = nsPerRun(2000, [&](size_t i) {
+        const double PERC = (i % 100) / 100.0;
+        const double GAP  = animatedGap(5, PERC, false);
+        const auto   SIZE = lerp(grid.zoomedSize(MONITOR), MONITOR, PERC);
+
+        for (size_t id = 0; id < tiles; ++id) {
+            if (!grid.isResident(id))
+                continue;
+
+            sink = sink + grid.tileBox(id, SIZE, GAP).x;
+        }
+    });
+
+    // a cursor sweep over the monitor
+    const double CURSOR = nsPerRun(200000, [&](size_t i) { sink = sink + grid.tileAt({(double)(i * 7 % 2560), (double)(i * 13 % 1440)}, MONITOR); });
+
+    // one swipe update
+    const double SWIPE = nsPerRun(200000, [&](size_t i) {
+        const float PERC = swipeProgress(i % 300, 300);
+        sink             = sink + lerp(MONITOR, grid.zoomedSize(MONITOR), PERC).x + lerp(Vector2D{}, grid.zoomedPos(i % tiles, MONITOR, 1.0), PERC).y;
+    });
+
+    // the nearest-first capture order on open
+    std::vector<int> order(tiles);
+    const double     OPEN = nsPerRun(200, [&](size_t i) {
+        const int CURRENT = i % tiles;
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::stable_sort(order, [&grid, CURRENT](int a, int b) { return grid.tileDistance(a, CURRENT) < grid.tileDistance(b, CURRENT); });
+        sink = sink + order.back();
+    });
+
+    std::printf("%5dx%-3d %6zu tiles %12.1f %12.1f %12.1f %12.1f\n", columns, columns, tiles, FRAME, CURSOR, SWIPE, OPEN);
+}
+
+int main() {
+    std::printf("%9s %12s %12s %12s %12s %12s\n", "grid", "", "frame ns", "tileAt ns", "swipe ns", "open ns");
+
+    for (int columns = 2; columns <= 20; ++columns) {
+        benchGrid(columns, columns * columns);
+        benchGrid(columns, columns * columns * 4);
+    }
+
+    return 0;
+}
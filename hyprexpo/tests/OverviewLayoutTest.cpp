@@ -0,0 +1,81 @@
+#include "../OverviewLayout.hpp"
+#include "shared.hpp"
+
+int main() {
+    int ret = 0;
+
+    // scrolling only kicks in with more rows than columns
+    EXPECT((SOverviewGrid{.columns = 3, .tiles = 9}.maxScrollRow()), 0);
+    EXPECT((SOverviewGrid{.columns = 3, .tiles = 4}.maxScrollRow()), 0);
+    EXPECT((SOverviewGrid{.columns = 3, .tiles = 30}.maxScrollRow()), 7);
+    EXPECT((SOverviewGrid{.columns = 4, .tiles = 17}.maxScrollRow()), 1);
+
+    // centered where possible, clamped at both ends
+    EXPECT((SOverviewGrid{.columns = 3, .tiles = 30}.scrollRowFor(0)), 0);
+    EXPECT((SOverviewGrid{.columns = 3, .tiles = 30}.scrollRowFor(14)), 3);
+    EXPECT((SOverviewGrid{.columns = 3, .tiles = 30}.scrollRowFor(29)), 7);
+    EXPECT((SOverviewGrid{.columns = 3, .tiles = 9}.scrollRowFor(8)), 0);
+
+    // rows 2-4 are in view, rows 1 and 5 are kept resident around them
+    const SOverviewGrid SCROLLED{.columns = 3, .tiles = 30, .scrollRow = 2};
+    EXPECT(SCROLLED.isVisible(5), false);
+    EXPECT(SCROLLED.isVisible(6), true);
+    EXPECT(SCROLLED.isVisible(14), true);
+    EXPECT(SCROLLED.isVisible(15), false);
+    EXPECT(SCROLLED.isResident(2), false);
+    EXPECT(SCROLLED.isResident(3), true);
+    EXPECT(SCROLLED.isResident(15), true);
+    EXPECT(SCROLLED.isResident(18), false);
+
+    EXPECT(SCROLLED.tileCoords(7).x, 1);
+    EXPECT(SCROLLED.tileCoords(7).y, 0);
+    EXPECT(SCROLLED.tileCoords(5).y, -1);
+
+    const SOverviewGrid GRID{.columns = 3, .tiles = 9};
+    EXPECT(GRID.tileDistance(0, 0), 0);
+    EXPECT(GRID.tileDistance(0, 8), 2);
+    EXPECT(GRID.tileDistance(4, 5), 1);
+    EXPECT(GRID.tileDistance(1, 7), 2);
+
+    // 310x160 with 5px gaps leaves 100x50 tiles
+    EXPECT_NEAR(GRID.tileBox(4, {310, 160}, 5).x, 105);
+    EXPECT_NEAR(GRID.tileBox(4, {310, 160}, 5).y, 55);
+    EXPECT_NEAR(GRID.tileBox(4, {310, 160}, 5).w, 100);
+    EXPECT_NEAR(GRID.tileBox(4, {310, 160}, 5).h, 50);
+    EXPECT_NEAR(GRID.tileBox(8, {310, 160}, 5).x, 210);
+    EXPECT_NEAR(GRID.tileBox(8, {310, 160}, 5).y, 110);
+    EXPECT_NEAR(SCROLLED.tileBox(7, {310, 160}, 5).y, 0);
+    EXPECT_NEAR(SCROLLED.tileBox(5, {310, 160}, 5).y, -55);
+
+    EXPECT(GRID.tileAt({150, 150}, {300, 300}), 4);
+    EXPECT(GRID.tileAt({299, 0}, {300, 300}), 2);
+    EXPECT(GRID.tileAt({0, 299}, {300, 300}), 6);
+    EXPECT(GRID.tileAt({-10, 0}, {300, 300}), 0);
+    EXPECT((SOverviewGrid{.columns = 3, .tiles = 8}.tileAt({299, 299}, {300, 300})), 7);
+    EXPECT(SCROLLED.tileAt({0, 0}, {300, 300}), 6);
+    EXPECT(SCROLLED.tileAt({250, 250}, {300, 300}), 14);
+
+    EXPECT_NEAR(GRID.zoomedSize({1920, 1080}).x, 5760);
+    EXPECT_NEAR(GRID.zoomedSize({1920, 1080}).y, 3240);
+    EXPECT_NEAR(GRID.zoomedPos(4, {300, 300}, 1.0).x, -300);
+    EXPECT_NEAR(GRID.zoomedPos(4, {300, 300}, 1.0).y, -300);
+    EXPECT_NEAR(GRID.zoomedPos(4, {300, 300}, 2.0).x, -600);
+    EXPECT_NEAR(GRID.zoomedPos(0, {300, 300}, 1.0).x, 0);
+    EXPECT_NEAR(SCROLLED.zoomedPos(7, {300, 300}, 1.0).x, -300);
+    EXPECT_NEAR(SCROLLED.zoomedPos(7, {300, 300}, 1.0).y, 0);
+
+    EXPECT_NEAR(lerp(0.F, 10.F, 0.5F), 5);
+    EXPECT_NEAR(lerp(Vector2D{0, 0}, Vector2D{10, 20}, 0.25F).x, 2.5);
+    EXPECT_NEAR(lerp(Vector2D{0, 0}, Vector2D{10, 20}, 0.25F).y, 5);
+
+    EXPECT_NEAR(animatedGap(10, 0.25, false), 2.5);
+    EXPECT_NEAR(animatedGap(10, 0.25, true), 7.5);
+
+    EXPECT_NEAR(swipeProgress(0, 200), 1);
+    EXPECT_NEAR(swipeProgress(100, 200), 0.5);
+    EXPECT_NEAR(swipeProgress(200, 200), 0);
+    EXPECT_NEAR(swipeProgress(-50, 200), 1);
+    EXPECT_NEAR(swipeProgress(400, 200), 0);
+
+    return ret;
+}
@@ -0,0 +1,88 @@
+#include "../ThumbnailCodec.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Cost of the thumbnail kernels on monitor sized frames: the 2x2 downscale with and without SIMD, and the RLE
+// compress / decompress on a mostly flat desktop and on noise. Build with optimizations for meaningful numbers.
+
+static volatile double sink = 0;
+
+template <typename F>
+static double nsPerRun(size_t runs, F&& fn) {
+    const auto BEGIN = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < runs; ++i) {
+        fn(i);
+    }
+
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - BEGIN).count() / runs;
+}
+
+// a flat wallpaper with a few rows of noise, roughly what a terminal or two on it looks like
+static std::vector<uint8_t> desktop(int w, int h) {
+    std::mt19937         rng(w + h);
+    std::vector<uint8_t> out((size_t)w * h * 4);
+
+    for (size_t i = 0; i < out.size(); i += 4) {
+        const bool BUSY = (i / 4 / w) % 16 == 0;
+        out[i]          = BUSY ? rng() & 0xFF : 0x20;
+        out[i + 1]      = BUSY ? rng() & 0xFF : 0x30;
+        out[i + 2]      = 0x40;
+        out[i + 3]      = 0xFF;
+    }
+
+    return out;
+}
+
+static std::vector<uint8_t> noise(int w, int h) {
+    std::mt19937         rng(w * h);
+    std::vector<uint8_t> out((size_t)w * h * 4);
+    for (auto& b : out) {
+        b = rng() & 0xFF;
+    }
+
+    return out;
+}
+
+static void benchFrame(int w, int h) {
+    const size_t         PIXELS  = (size_t)w * h;
+    const auto           DESKTOP = desktop(w, h);
+    const auto           NOISE   = noise(w, h);
+    std::vector<uint8_t> half(PIXELS, 0), out(PIXELS * 4);
+
+    const double SIMD = nsPerRun(50, [&](size_t) {
+        downscaleBox2x(DESKTOP.data(), w, h, half.data());
+        sink = sink + half[half.size() / 2];
+    });
+
+    const double SCALAR = nsPerRun(50, [&](size_t) {
+        downscaleBox2xScalar(DESKTOP.data(), w, h, half.data());
+        sink = sink + half[half.size() / 2];
+    });
+
+    std::vector<uint8_t> data;
+    const double         COMPRESS = nsPerRun(20, [&](size_t) {
+        data = compressPixels(DESKTOP.data(), PIXELS);
+        sink = sink + data.size();
+    });
+
+    const double DECOMPRESS = nsPerRun(20, [&](size_t) { sink = sink + decompressPixels(data, out.data(), PIXELS); });
+
+    // the give up path, which has to get through most of the frame before it knows
+    const double NOISY = nsPerRun(20, [&](size_t) { sink = sink + compressPixels(NOISE.data(), PIXELS).size(); });
+
+    std::printf("%5dx%-5d %12.1f %12.1f %8.2fx %12.1f %12.1f %12.1f %7.1f%%\n", w, h, SIMD / 1000, SCALAR / 1000, SCALAR / SIMD, COMPRESS / 1000, DECOMPRESS / 1000,
+                NOISY / 1000, 100.0 * data.size() / (PIXELS * 4));
+}
+
+int main() {
+    std::printf("%11s %12s %12s %9s %12s %12s %12s %8s\n", "frame", "simd us", "scalar us", "speedup", "rle us", "unrle us", "noise us", "ratio");
+
+    for (const auto& [w, h] : {std::pair{1280, 720}, {1281, 721}, {1920, 1080}, {2560, 1440}, {3840, 2160}}) {
+        benchFrame(w, h);
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include "../ThumbnailCodec.hpp"
+#include "shared.hpp"
+
+#include <random>
+#include <vector>
+
+static std::vector<uint8_t> noise(size_t bytes, uint32_t seed) {
+    std::mt19937         rng(seed);
+    std::vector<uint8_t> out(bytes);
+    for (auto& b : out) {
+        b = rng() & 0xFF;
+    }
+
+    return out;
+}
+
+// the vector path against the scalar one on the same noise, which exercises every rounding case
+static bool downscaleMatches(int w, int h) {
+    const auto           SRC = noise((size_t)w * h * 4, w * 31 + h);
+    std::vector<uint8_t> simd((size_t)(w / 2) * (h / 2) * 4, 0xAA), scalar(simd.size(), 0x55);
+
+    downscaleBox2x(SRC.data(), w, h, simd.data());
+    downscaleBox2xScalar(SRC.data(), w, h, scalar.data());
+
+    return simd == scalar;
+}
+
+static std::vector<uint8_t> pixels(std::initializer_list<std::pair<size_t, uint32_t>> runs) {
+    std::vector<uint8_t> out;
+    for (const auto& [count, pixel] : runs) {
+        for (size_t i = 0; i < count; ++i) {
+            out.insert(out.end(), {(uint8_t)(pixel >> 24), (uint8_t)(pixel >> 16), (uint8_t)(pixel >> 8), (uint8_t)pixel});
+        }
+    }
+
+    return out;
+}
+
+static bool roundTrips(const std::vector<uint8_t>& src) {
+    const auto           DATA = compressPixels(src.data(), src.size() / 4);
+    std::vector<uint8_t> out(src.size());
+
+    return !DATA.empty() && decompressPixels(DATA, out.data(), src.size() / 4) && out == src;
+}
+
+int main() {
+    int ret = 0;
+
+    // odd sizes leave a scalar tail in every row, 1x1 has nothing to write at all
+    EXPECT(downscaleMatches(1, 1), true);
+    EXPECT(downscaleMatches(3, 5), true);
+    EXPECT(downscaleMatches(2, 2), true);
+    EXPECT(downscaleMatches(8, 6), true);
+    EXPECT(downscaleMatches(1280, 720), true);
+    EXPECT(downscaleMatches(1281, 720), true);
+    EXPECT(downscaleMatches(1281, 721), true);
+
+    // (a + b + c + d + 2) / 4, rounding half up. 4x2 so both output pixels come from the vector path.
+    const auto           QUAD = pixels({{1, 0x00FF0102}, {1, 0x01FF0102}, {1, 0x00FF0102}, {1, 0x01FF0102}, {1, 0x01FF0103}, {1, 0x01FE0103}, {1, 0x01FF0103}, {1, 0x01FE0103}});
+    std::vector<uint8_t> avg(8);
+    downscaleBox2x(QUAD.data(), 4, 2, avg.data());
+    EXPECT((int)avg[0], 1);
+    EXPECT((int)avg[1], 255);
+    EXPECT((int)avg[2], 1);
+    EXPECT((int)avg[3], 3);
+    EXPECT((int)avg[7], 3);
+
+    // a run caps at 255 pixels, longer ones are split
+    const auto RUN255 = pixels({{255, 0x11223344}, {1, 0x55667788}});
+    const auto DATA   = compressPixels(RUN255.data(), 256);
+    EXPECT(DATA.size(), 10);
+    EXPECT((int)DATA[0], 255);
+    EXPECT((int)DATA[5], 1);
+    EXPECT(roundTrips(RUN255), true);
+    EXPECT(compressPixels(pixels({{256, 0x11223344}}).data(), 256).size(), 10);
+    EXPECT(roundTrips(pixels({{256, 0x11223344}})), true);
+    EXPECT(roundTrips(pixels({{600, 0xFFFFFFFF}, {3, 0x00000000}, {255, 0x10101010}, {40, 0xFFFFFFFF}})), true);
+
+    // not worth it: noise, or too few pixels to ever win
+    EXPECT(compressPixels(noise(4096, 1).data(), 1024).empty(), true);
+    EXPECT(compressPixels(pixels({{1, 0x11223344}}).data(), 1).empty(), true);
+
+    // anything that doesn't decode to exactly the given number of pixels
+    std::vector<uint8_t> out(256 * 4);
+    EXPECT(decompressPixels(DATA, out.data(), 255), false);
+    EXPECT(decompressPixels(DATA, out.data(), 256), true);
+    EXPECT(decompressPixels({0, 1, 2, 3, 4}, out.data(), 0), false);
+    EXPECT(decompressPixels({255, 1, 2, 3, 4, 1}, out.data(), 255), false);
+
+    return ret;
+}
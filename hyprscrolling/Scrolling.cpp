@@ -14,88 +14,97 @@
 using namespace Hyprutils::String;
 using namespace Hyprutils::Utils;
 
-constexpr float MIN_COLUMN_WIDTH = 0.05F;
-constexpr float MAX_COLUMN_WIDTH = 1.F;
-constexpr float MIN_ROW_HEIGHT   = 0.1F;
-constexpr float MAX_ROW_HEIGHT   = 1.F;
-
 //
 void SColumnData::add(PHLWINDOW w) {
-    for (auto& wd : windowDatas) {
-        wd->windowSize *= (float)windowDatas.size() / (float)(windowDatas.size() + 1);
-    }
-
-    windowDatas.emplace_back(makeShared<SScrollingWindowData>(w, self.lock(), 1.F / (float)(windowDatas.size() + 1)));
+    add(makeShared<SScrollingWindowData>(w, self.lock()));
 }
 
 void SColumnData::add(SP<SScrollingWindowData> w) {
-    for (auto& wd : windowDatas) {
-        wd->windowSize *= (float)windowDatas.size() / (float)(windowDatas.size() + 1);
-    }
-
     windowDatas.emplace_back(w);
-    w->column     = self;
-    w->windowSize = 1.F / (float)(windowDatas.size());
+    w->column = self;
+
+    if (!workspace)
+        return;
+
+    workspace->core.addRow(index);
+
+    if (workspace->layout)
+        workspace->layout->indexWindow(w);
 }
 
 void SColumnData::remove(PHLWINDOW w) {
-    const auto SIZE_BEFORE = windowDatas.size();
-    std::erase_if(windowDatas, [&w](const auto& e) { return e->window == w; });
+    const auto IT = std::ranges::find_if(windowDatas, [&w](const auto& e) { return e->window == w; });
 
-    if (SIZE_BEFORE == windowDatas.size() && SIZE_BEFORE > 0)
+    if (IT == windowDatas.end())
         return;
 
-    float newMaxSize = 0.F;
-    for (auto& wd : windowDatas) {
-        newMaxSize += wd->windowSize;
-    }
+    const size_t ROW = IT - windowDatas.begin();
+    windowDatas.erase(IT);
 
-    for (auto& wd : windowDatas) {
-        wd->windowSize *= 1.F / newMaxSize;
-    }
+    if (!workspace)
+        return;
+
+    if (workspace->layout)
+        workspace->layout->unindexWindow(w);
+
+    workspace->core.removeRow(index, ROW);
 
-    if (windowDatas.empty() && workspace)
+    if (windowDatas.empty())
         workspace->remove(self.lock());
 }
 
 void SColumnData::up(SP<SScrollingWindowData> w) {
-    for (size_t i = 1; i < windowDatas.size(); ++i) {
-        if (windowDatas[i] != w)
-            continue;
+    const auto ROW = row(w);
 
-        std::swap(windowDatas[i], windowDatas[i - 1]);
-    }
+    if (ROW == -1 || !workspace || !workspace->core.moveRow(index, ROW, false))
+        return;
+
+    std::swap(windowDatas[ROW], windowDatas[ROW - 1]);
 }
 
 void SColumnData::down(SP<SScrollingWindowData> w) {
-    for (size_t i = 0; i < windowDatas.size() - 1; ++i) {
-        if (windowDatas[i] != w)
-            continue;
+    const auto ROW = row(w);
 
-        std::swap(windowDatas[i], windowDatas[i + 1]);
-    }
+    if (ROW == -1 || !workspace || !workspace->core.moveRow(index, ROW, true))
+        return;
+
+    std::swap(windowDatas[ROW], windowDatas[ROW + 1]);
 }
 
 SP<SScrollingWindowData> SColumnData::next(SP<SScrollingWindowData> w) {
-    for (size_t i = 0; i < windowDatas.size() - 1; ++i) {
-        if (windowDatas[i] != w)
-            continue;
+    const auto ROW = row(w);
 
-        return windowDatas[i + 1];
-    }
+    if (ROW == -1 || ROW == (int64_t)windowDatas.size() - 1)
+        return nullptr;
 
-    return nullptr;
+    return windowDatas[ROW + 1];
 }
 
 SP<SScrollingWindowData> SColumnData::prev(SP<SScrollingWindowData> w) {
-    for (size_t i = 1; i < windowDatas.size(); ++i) {
-        if (windowDatas[i] != w)
-            continue;
+    const auto ROW = row(w);
 
-        return windowDatas[i - 1];
-    }
+    if (ROW <= 0)
+        return nullptr;
+
+    return windowDatas[ROW - 1];
+}
+
+int64_t SColumnData::row(SP<SScrollingWindowData> w) {
+    const auto IT = std::ranges::find(windowDatas, w);
+
+    if (IT == windowDatas.end())
+        return -1;
+
+    return IT - windowDatas.begin();
+}
+
+float SColumnData::width() {
+    return workspace ? workspace->core.columnWidth(index) : 1.F;
+}
 
-    return nullptr;
+void SColumnData::setWidth(float width) {
+    if (workspace)
+        workspace->core.setColumnWidth(index, width);
 }
 
 bool SColumnData::has(PHLWINDOW w) {
@@ -106,7 +115,7 @@ SP<SColumnData> SWorkspaceData::add() {
     static const auto PCOLWIDTH = CConfigValue<Hyprlang::FLOAT>("plugin:hyprscrolling:column_width");
     auto              col       = columns.emplace_back(makeShared<SColumnData>(self.lock()));
     col->self                   = col;
-    col->columnWidth            = *PCOLWIDTH;
+    col->index                  = core.addColumn(*PCOLWIDTH);
     return col;
 }
 
@@ -114,182 +123,274 @@ SP<SColumnData> SWorkspaceData::add(size_t after) {
     static const auto PCOLWIDTH = CConfigValue<Hyprlang::FLOAT>("plugin:hyprscrolling:column_width");
     auto              col       = makeShared<SColumnData>(self.lock());
     col->self                   = col;
-    col->columnWidth            = *PCOLWIDTH;
     columns.insert(columns.begin() + after + 1, col);
+    core.insertColumn(after, *PCOLWIDTH);
+    reindex(after + 1);
     return col;
 }
 
 int64_t SWorkspaceData::idx(SP<SColumnData> c) {
-    for (size_t i = 0; i < columns.size(); ++i) {
-        if (columns[i] == c)
-            return i;
-    }
+    if (!c || c->index >= columns.size() || columns[c->index] != c)
+        return -1;
 
-    return -1;
+    return c->index;
 }
 
 void SWorkspaceData::remove(SP<SColumnData> c) {
-    std::erase(columns, c);
+    const auto IDX = idx(c);
+    if (IDX == -1)
+        return;
+
+    columns.erase(columns.begin() + IDX);
+    core.removeColumn(IDX);
+    reindex(IDX);
 }
 
-SP<SColumnData> SWorkspaceData::next(SP<SColumnData> c) {
-    for (size_t i = 0; i < columns.size(); ++i) {
-        if (columns[i] != c)
-            continue;
+SP<SColumnData> SWorkspaceData::promote(SP<SScrollingWindowData> w) {
+    static const auto PCOLWIDTH = CConfigValue<Hyprlang::FLOAT>("plugin:hyprscrolling:column_width");
 
-        if (i == columns.size() - 1)
-            return nullptr;
+    const auto        OLD = w->column.lock();
+    const auto        COL = idx(OLD);
+    const auto        ROW = OLD ? OLD->row(w) : -1;
 
-        return columns[i + 1];
-    }
+    if (COL == -1 || ROW == -1)
+        return nullptr;
+
+    core.promote(COL, ROW, *PCOLWIDTH);
+
+    // same moves as the core just did, the window stays indexed as it's the same data
+    auto col  = makeShared<SColumnData>(self.lock());
+    col->self = col;
+    columns.insert(columns.begin() + COL + 1, col);
+
+    OLD->windowDatas.erase(OLD->windowDatas.begin() + ROW);
+    col->windowDatas.emplace_back(w);
+    w->column = col;
 
-    return nullptr;
+    if (OLD->windowDatas.empty())
+        columns.erase(columns.begin() + COL);
+
+    reindex(COL);
+    return col;
 }
 
-SP<SColumnData> SWorkspaceData::prev(SP<SColumnData> c) {
-    for (size_t i = 0; i < columns.size(); ++i) {
-        if (columns[i] != c)
-            continue;
+void SWorkspaceData::reindex(size_t from) {
+    for (size_t i = from; i < columns.size(); ++i) {
+        columns[i]->index = i;
+    }
+}
 
-        if (i == 0)
-            return nullptr;
+void SWorkspaceData::verifyCore() {
+    bool synced = core.columns() == columns.size();
 
-        return columns[i - 1];
+    for (size_t i = 0; synced && i < columns.size(); ++i) {
+        synced = columns[i]->index == i && core.rows(i) == columns[i]->windowDatas.size();
     }
 
-    return nullptr;
+    if (!synced)
+        Debug::log(ERR, "[scroller] layout core out of sync for workspace {}: {} columns, core has {}", workspace->m_id, columns.size(), core.columns());
 }
 
-void SWorkspaceData::centerCol(SP<SColumnData> c) {
-    if (!c)
-        return;
+SP<SColumnData> SWorkspaceData::next(SP<SColumnData> c) {
+    const auto IDX = idx(c);
 
-    static const auto PFSONONE = CConfigValue<Hyprlang::INT>("plugin:hyprscrolling:fullscreen_on_one_column");
+    if (IDX == -1 || IDX == (int64_t)columns.size() - 1)
+        return nullptr;
 
-    PHLMONITOR        PMONITOR    = workspace->m_monitor.lock();
-    double            currentLeft = 0;
-    const auto        USABLE      = layout->usableAreaFor(PMONITOR);
+    return columns[IDX + 1];
+}
 
-    for (const auto& COL : columns) {
-        const double ITEM_WIDTH = *PFSONONE && columns.size() == 1 ? USABLE.w : USABLE.w * COL->columnWidth;
+SP<SColumnData> SWorkspaceData::prev(SP<SColumnData> c) {
+    const auto IDX = idx(c);
 
-        if (COL != c)
-            currentLeft += ITEM_WIDTH;
-        else {
-            leftOffset = currentLeft - (USABLE.w - ITEM_WIDTH) / 2.F;
-            return;
-        }
-    }
+    if (IDX <= 0)
+        return nullptr;
+
+    return columns[IDX - 1];
 }
 
-void SWorkspaceData::fitCol(SP<SColumnData> c) {
-    if (!c)
+void SWorkspaceData::centerCol(SP<SColumnData> c) {
+    const auto IDX = idx(c);
+    if (IDX == -1)
         return;
 
-    static const auto PFSONONE = CConfigValue<Hyprlang::INT>("plugin:hyprscrolling:fullscreen_on_one_column");
-
-    PHLMONITOR        PMONITOR    = workspace->m_monitor.lock();
-    double            currentLeft = 0;
-    const auto        USABLE      = layout->usableAreaFor(PMONITOR);
+    core.centerOn(IDX, usableWidth());
+}
 
-    for (const auto& COL : columns) {
-        const double ITEM_WIDTH = *PFSONONE && columns.size() == 1 ? USABLE.w : USABLE.w * COL->columnWidth;
+void SWorkspaceData::fitCol(SP<SColumnData> c) {
+    const auto IDX = idx(c);
+    if (IDX == -1)
+        return;
 
-        if (COL != c)
-            currentLeft += ITEM_WIDTH;
-        else {
-            leftOffset = std::clamp((double)leftOffset, currentLeft - USABLE.w + ITEM_WIDTH, currentLeft);
-            return;
-        }
-    }
+    core.fitInto(IDX, usableWidth());
 }
 
 SP<SColumnData> SWorkspaceData::atCenter() {
-    static const auto PFSONONE = CConfigValue<Hyprlang::INT>("plugin:hyprscrolling:fullscreen_on_one_column");
+    PHLMONITOR PMONITOR = workspace->m_monitor.lock();
 
-    PHLMONITOR        PMONITOR    = workspace->m_monitor.lock();
-    double            currentLeft = leftOffset;
-    const auto        USABLE      = layout->usableAreaFor(PMONITOR);
+    // first column whose right edge is past the middle of the monitor
+    const auto IDX = core.columnEndingAt(PMONITOR->m_size.x / 2.0 - 2 - core.viewOffset, layout->usableAreaFor(PMONITOR).w);
 
-    for (const auto& COL : columns) {
-        const double ITEM_WIDTH = *PFSONONE && columns.size() == 1 ? USABLE.w : USABLE.w * COL->columnWidth;
+    if (IDX >= columns.size())
+        return nullptr;
 
-        currentLeft += ITEM_WIDTH;
+    return columns[IDX];
+}
 
-        if (currentLeft >= PMONITOR->m_size.x / 2.0 - 2)
-            return COL;
+void SWorkspaceData::scheduleRecalculate(bool forceInstant) {
+    if (!workspace || !workspace->m_monitor) {
+        recalculate(forceInstant);
+        return;
     }
 
-    return nullptr;
+    // anything reading the view offset before the flush should see it in bounds, like after a recalculate
+    core.clampView(usableWidth());
+
+    pendingRecalc.scheduled = true;
+    pendingRecalc.instant   = pendingRecalc.instant || forceInstant;
+
+    g_pCompositor->scheduleFrameForMonitor(workspace->m_monitor.lock());
 }
 
 void SWorkspaceData::recalculate(bool forceInstant) {
-    static const auto PFSONONE = CConfigValue<Hyprlang::INT>("plugin:hyprscrolling:fullscreen_on_one_column");
+    static const auto PMARGIN = CConfigValue<Hyprlang::INT>("plugin:hyprscrolling:offscreen_margin");
+
+    // covers whatever was scheduled before
+    forceInstant  = forceInstant || (pendingRecalc.scheduled && pendingRecalc.instant);
+    pendingRecalc = {};
 
     if (!workspace || !workspace) {
         Debug::log(ERR, "[scroller] broken internal state on workspace data");
         return;
     }
 
-    leftOffset = std::clamp((double)leftOffset, 0.0, maxWidth());
-
-    const auto   MAX_WIDTH = maxWidth();
+#ifndef NDEBUG
+    verifyCore();
+#endif
 
     PHLMONITOR   PMONITOR = workspace->m_monitor.lock();
 
     const CBox   USABLE = layout->usableAreaFor(PMONITOR);
 
-    double       currentLeft = 0;
-    const double cameraLeft  = MAX_WIDTH < USABLE.w ? std::round((MAX_WIDTH - USABLE.w) / 2.0) : leftOffset; // layout pixels
+    core.clampView(USABLE.w);
 
-    for (const auto& COL : columns) {
-        double       currentTop = 0.0;
-        const double ITEM_WIDTH = *PFSONONE && columns.size() == 1 ? USABLE.w : USABLE.w * COL->columnWidth;
+    const double cameraLeft = core.camera(USABLE.w); // layout pixels
+
+    // resolved once per pass, selectors like w[tv1] or f[1] can match differently after any change
+    const auto   RULES = layout->rulesFor(workspace.lock());
+
+    // gaps aren't part of the layout boxes, so the diff below wouldn't notice them changing
+    if (RULES != lastRules) {
+        invalidateApplied();
+        lastRules = RULES;
+    }
+
+    lastRecalc = {};
+
+    for (size_t i = 0; i < columns.size(); ++i) {
+        const auto   COL         = columns[i];
+        double       currentTop  = 0.0;
+        const double currentLeft = core.left(i, USABLE.w);
+        const double ITEM_WIDTH  = core.width(i, USABLE.w);
+        const bool   OFFSCREEN   = core.isOffscreen(i, cameraLeft, USABLE.w, *PMARGIN);
+
+        for (size_t j = 0; j < COL->windowDatas.size(); ++j) {
+            const auto& WINDOW = COL->windowDatas[j];
+            const float HEIGHT = core.rowHeight(i, j);
 
-        for (const auto& WINDOW : COL->windowDatas) {
             WINDOW->layoutBox =
-                CBox{currentLeft, currentTop, ITEM_WIDTH, WINDOW->windowSize * USABLE.h}.translate(PMONITOR->m_position + PMONITOR->m_reservedTopLeft + Vector2D{-cameraLeft, 0.0});
+                rowBox(currentLeft, ITEM_WIDTH, currentTop, HEIGHT, USABLE.h).translate(PMONITOR->m_position + PMONITOR->m_reservedTopLeft + Vector2D{-cameraLeft, 0.0});
 
-            currentTop += WINDOW->windowSize * USABLE.h;
+            currentTop += HEIGHT * USABLE.h;
 
-            layout->applyNodeDataToWindow(WINDOW, forceInstant);
-        }
+            // unchanged boxes would only re-send the same geometry and restart animations towards the same goal
+            if (WINDOW->appliedBox == WINDOW->layoutBox) {
+                lastRecalc.skipped++;
+                continue;
+            }
 
-        currentLeft += ITEM_WIDTH;
+            // nobody gets to see it move, so don't animate it
+            const bool INSTANT = forceInstant || (WINDOW->offscreen && OFFSCREEN);
+            WINDOW->offscreen  = OFFSCREEN;
+
+            layout->updateSuspended(WINDOW);
+
+            if (OFFSCREEN)
+                lastRecalc.offscreen++;
+
+            // camera moves shift whole columns sideways, those only need their position moved
+            if (layout->panWindow(WINDOW, INSTANT)) {
+                WINDOW->appliedBox = WINDOW->layoutBox;
+                lastRecalc.panned++;
+                continue;
+            }
+
+            layout->applyNodeDataToWindow(WINDOW, INSTANT, &RULES);
+            WINDOW->appliedBox = WINDOW->layoutBox;
+            lastRecalc.applied++;
+        }
     }
-}
 
-double SWorkspaceData::maxWidth() {
-    static const auto PFSONONE = CConfigValue<Hyprlang::INT>("plugin:hyprscrolling:fullscreen_on_one_column");
+    layout->m_recalcStats.applied += lastRecalc.applied;
+    layout->m_recalcStats.panned += lastRecalc.panned;
+    layout->m_recalcStats.skipped += lastRecalc.skipped;
 
-    PHLMONITOR        PMONITOR    = workspace->m_monitor.lock();
-    double            currentLeft = 0;
-    const auto        USABLE      = layout->usableAreaFor(PMONITOR);
+    Debug::log(TRACE, "[scroller] recalculate: {} windows applied, {} panned, {} skipped, {} moved offscreen", lastRecalc.applied, lastRecalc.panned, lastRecalc.skipped,
+               lastRecalc.offscreen);
+}
 
+void SWorkspaceData::updateSuspended() {
     for (const auto& COL : columns) {
-        const double ITEM_WIDTH = *PFSONONE && columns.size() == 1 ? USABLE.w : USABLE.w * COL->columnWidth;
+        for (const auto& WINDOW : COL->windowDatas) {
+            layout->updateSuspended(WINDOW);
+        }
+    }
+}
 
-        currentLeft += ITEM_WIDTH;
+void SWorkspaceData::invalidateApplied() {
+    for (const auto& COL : columns) {
+        for (const auto& WINDOW : COL->windowDatas) {
+            WINDOW->appliedBox.reset();
+        }
     }
+}
+
+double SWorkspaceData::maxWidth() {
+    return core.maxWidth(usableWidth());
+}
 
-    return currentLeft;
+double SWorkspaceData::usableWidth() {
+    return layout->usableAreaFor(workspace->m_monitor.lock()).w;
 }
 
 bool SWorkspaceData::visible(SP<SColumnData> c) {
-    const auto USABLE    = layout->usableAreaFor(workspace->m_monitor.lock());
-    float      totalLeft = 0;
-    for (const auto& col : columns) {
-        if (col == c)
-            return (totalLeft >= leftOffset && totalLeft < leftOffset + USABLE.w) ||
-                (totalLeft + col->columnWidth * USABLE.w >= leftOffset && totalLeft + col->columnWidth * USABLE.w < leftOffset + USABLE.w);
-
-        totalLeft += col->columnWidth * USABLE.w;
-    }
+    const auto IDX = idx(c);
+    if (IDX == -1)
+        return false;
 
-    return false;
+    return core.isVisible(IDX, usableWidth());
 }
 
-void CScrollingLayout::applyNodeDataToWindow(SP<SScrollingWindowData> data, bool force) {
+bool SWorkspaceRules::operator==(const SWorkspaceRules& other) const {
+    const auto SAME = [](const CCssGapData& a, const CCssGapData& b) { return a.m_top == b.m_top && a.m_right == b.m_right && a.m_bottom == b.m_bottom && a.m_left == b.m_left; };
+
+    return SAME(gapsIn, other.gapsIn) && SAME(gapsOut, other.gapsOut);
+}
+
+SWorkspaceRules CScrollingLayout::rulesFor(PHLWORKSPACE ws) {
+    static auto PGAPSINDATA  = CConfigValue<Hyprlang::CUSTOMTYPE>("general:gaps_in");
+    static auto PGAPSOUTDATA = CConfigValue<Hyprlang::CUSTOMTYPE>("general:gaps_out");
+    auto* const PGAPSIN      = (CCssGapData*)(PGAPSINDATA.ptr())->getData();
+    auto* const PGAPSOUT     = (CCssGapData*)(PGAPSOUTDATA.ptr())->getData();
+
+    // get specific gaps and rules for this workspace,
+    // if user specified them in config
+    const auto WORKSPACERULE = g_pConfigManager->getWorkspaceRuleFor(ws);
+
+    return {.gapsIn = WORKSPACERULE.gapsIn.value_or(*PGAPSIN), .gapsOut = WORKSPACERULE.gapsOut.value_or(*PGAPSOUT)};
+}
+
+void CScrollingLayout::applyNodeDataToWindow(SP<SScrollingWindowData> data, bool force, const SWorkspaceRules* rules) {
     PHLMONITOR   PMONITOR;
     PHLWORKSPACE PWORKSPACE;
 
@@ -318,9 +419,6 @@ void CScrollingLayout::applyNodeDataToWindow(SP<SScrollingWindowData> data, bool
     const bool DISPLAYBOTTOM = STICKS(data->layoutBox.y + data->layoutBox.h, PMONITOR->m_position.y + PMONITOR->m_size.y - PMONITOR->m_reservedBottomRight.y);
 
     const auto PWINDOW = data->window.lock();
-    // get specific gaps and rules for this workspace,
-    // if user specified them in config
-    const auto WORKSPACERULE = g_pConfigManager->getWorkspaceRuleFor(PWORKSPACE);
 
     if (!validMapped(PWINDOW)) {
         Debug::log(ERR, "Node {} holding invalid {}!!", (uintptr_t)data.get(), PWINDOW);
@@ -334,13 +432,10 @@ void CScrollingLayout::applyNodeDataToWindow(SP<SScrollingWindowData> data, bool
     PWINDOW->unsetWindowData(PRIORITY_LAYOUT);
     PWINDOW->updateWindowData();
 
-    static auto PGAPSINDATA  = CConfigValue<Hyprlang::CUSTOMTYPE>("general:gaps_in");
-    static auto PGAPSOUTDATA = CConfigValue<Hyprlang::CUSTOMTYPE>("general:gaps_out");
-    auto* const PGAPSIN      = (CCssGapData*)(PGAPSINDATA.ptr())->getData();
-    auto* const PGAPSOUT     = (CCssGapData*)(PGAPSOUTDATA.ptr())->getData();
-
-    auto        gapsIn  = WORKSPACERULE.gapsIn.value_or(*PGAPSIN);
-    auto        gapsOut = WORKSPACERULE.gapsOut.value_or(*PGAPSOUT);
+    // recalculate passes the rules it resolved for the pass, one-off applies resolve them here
+    const auto  RULES   = rules ? *rules : rulesFor(PWORKSPACE);
+    const auto& gapsIn  = RULES.gapsIn;
+    const auto& gapsOut = RULES.gapsOut;
     CBox        nodeBox = data->layoutBox;
     nodeBox.round();
 
@@ -416,10 +511,71 @@ void CScrollingLayout::applyNodeDataToWindow(SP<SScrollingWindowData> data, bool
     PWINDOW->updateWindowDecos();
 }
 
+void CScrollingLayout::updateSuspended(SP<SScrollingWindowData> data) {
+    static const auto PSUSPEND = CConfigValue<Hyprlang::INT>("plugin:hyprscrolling:suspend_offscreen");
+
+    const auto        PWINDOW = data->window.lock();
+
+    if (!validMapped(PWINDOW))
+        return;
+
+    // same rule the compositor suspends by, we only add our offscreen columns on top
+    const bool HIDDEN    = PWINDOW->isHidden() || !PWINDOW->m_workspace || !PWINDOW->m_workspace->isVisible();
+    const bool OFFSCREEN = *PSUSPEND && data->offscreen && data->column && !PWINDOW->isFullscreen();
+
+    PWINDOW->setSuspended(HIDDEN || OFFSCREEN);
+}
+
+bool CScrollingLayout::panWindow(SP<SScrollingWindowData> data, bool instant) {
+    if (!data->appliedBox || !data->column || !data->column->workspace)
+        return false;
+
+    const auto PWINDOW  = data->window.lock();
+    const auto PMONITOR = data->column->workspace->workspace->m_monitor.lock();
+
+    if (!validMapped(PWINDOW) || !PMONITOR || PWINDOW->isFullscreen())
+        return false;
+
+    CBox from = *data->appliedBox, to = data->layoutBox;
+    from.round();
+    to.round();
+
+    if (from.size() != to.size() || from.y != to.y)
+        return false;
+
+    // outer gaps go on the monitor edges, a column sliding on or off an edge has to be laid out again
+    const double LEFTEDGE  = PMONITOR->m_position.x + PMONITOR->m_reservedTopLeft.x;
+    const double RIGHTEDGE = PMONITOR->m_position.x + PMONITOR->m_size.x - PMONITOR->m_reservedBottomRight.x;
+
+    if (STICKS(from.x, LEFTEDGE) != STICKS(to.x, LEFTEDGE) || STICKS(from.x + from.w, RIGHTEDGE) != STICKS(to.x + to.w, RIGHTEDGE))
+        return false;
+
+    const Vector2D DELTA = {to.x - from.x, 0.0};
+
+    // the size stays, so the client isn't sent a configure and decos don't need repositioning
+    PWINDOW->m_position      = PWINDOW->m_position + DELTA;
+    *PWINDOW->m_realPosition = PWINDOW->m_realPosition->goal() + DELTA;
+
+    if (instant) {
+        g_pHyprRenderer->damageWindow(PWINDOW);
+        PWINDOW->m_realPosition->warp();
+        g_pHyprRenderer->damageWindow(PWINDOW);
+    }
+
+    return true;
+}
+
 void CScrollingLayout::onEnable() {
     static const auto PCONFWIDTHS = CConfigValue<Hyprlang::STRING>("plugin:hyprscrolling:explicit_column_widths");
+    static const auto PFSONONE    = CConfigValue<Hyprlang::INT>("plugin:hyprscrolling:fullscreen_on_one_column");
 
     m_configCallback = g_pHookSystem->hookDynamic("configReloaded", [this](void* hk, SCallbackInfo& info, std::any param) {
+        // gaps and workspace rules might have changed without any box changing
+        for (const auto& ws : m_workspaceDatas) {
+            ws->core.setFullscreenOnOne(*PFSONONE);
+            ws->invalidateApplied();
+        }
+
         // bitch ass
         m_config.configuredWidths.clear();
 
@@ -431,6 +587,28 @@ void CScrollingLayout::onEnable() {
         }
     });
 
+    m_preRenderCallback = g_pHookSystem->hookDynamic("preRender", [this](void* hk, SCallbackInfo& info, std::any param) {
+        const auto PMONITOR = std::any_cast<PHLMONITOR>(param);
+
+        if (m_suspendedStale) {
+            for (const auto& ws : m_workspaceDatas) {
+                ws->updateSuspended();
+            }
+
+            m_suspendedStale = false;
+        }
+
+        for (const auto& ws : m_workspaceDatas) {
+            if (!ws->pendingRecalc.scheduled || !ws->workspace || ws->workspace->m_monitor != PMONITOR)
+                continue;
+
+            ws->recalculate();
+        }
+    });
+
+    // workspace changes make the compositor redo everyone's suspended state, put ours back on the next frame
+    m_workspaceCallback = g_pHookSystem->hookDynamic("workspace", [this](void* hk, SCallbackInfo& info, std::any param) { m_suspendedStale = true; });
+
     for (auto const& w : g_pCompositor->m_windows) {
         if (w->m_isFloating || !w->m_isMapped || w->isHidden())
             continue;
@@ -440,17 +618,36 @@ void CScrollingLayout::onEnable() {
 }
 
 void CScrollingLayout::onDisable() {
+    // don't leave anything we suspended behind
+    for (const auto& ws : m_workspaceDatas) {
+        for (const auto& col : ws->columns) {
+            for (const auto& wd : col->windowDatas) {
+                wd->offscreen = false;
+                updateSuspended(wd);
+            }
+        }
+    }
+
     m_workspaceDatas.clear();
+    m_workspaceIndex.clear();
+    m_windowIndex.clear();
     m_configCallback.reset();
+    m_preRenderCallback.reset();
+    m_workspaceCallback.reset();
 }
 
 void CScrollingLayout::onWindowCreatedTiling(PHLWINDOW window, eDirection direction) {
-    auto workspaceData = dataFor(window->m_workspace);
+    static const auto PFSONONE = CConfigValue<Hyprlang::INT>("plugin:hyprscrolling:fullscreen_on_one_column");
+
+    auto              workspaceData = dataFor(window->m_workspace);
 
     if (!workspaceData) {
         Debug::log(LOG, "[scrolling] No workspace data yet, creating");
         workspaceData       = m_workspaceDatas.emplace_back(makeShared<SWorkspaceData>(window->m_workspace, this));
         workspaceData->self = workspaceData;
+        workspaceData->core.setFullscreenOnOne(*PFSONONE);
+
+        m_workspaceIndex[window->m_workspace.get()] = workspaceData;
     }
 
     auto droppingOn = g_pCompositor->m_lastWindow.lock();
@@ -494,17 +691,20 @@ void CScrollingLayout::onWindowRemovedTiling(PHLWINDOW window) {
     if (!WS->next(DATA->column.lock())) {
         // move the view if this is the last column
         const auto USABLE = usableAreaFor(window->m_monitor.lock());
-        WS->leftOffset -= USABLE.w * DATA->column->columnWidth;
+        WS->core.viewOffset -= USABLE.w * DATA->column->width();
     }
 
     DATA->column->remove(window);
 
+    DATA->offscreen = false;
+    updateSuspended(DATA);
+
     WS->recalculate();
 
     if (!DATA->column) {
         // column got removed, let's ensure we don't leave any cringe extra space
-        const auto USABLE = usableAreaFor(window->m_monitor.lock());
-        WS->leftOffset    = std::clamp((double)WS->leftOffset, 0.0, std::max(WS->maxWidth() - USABLE.w, 1.0));
+        const auto USABLE   = usableAreaFor(window->m_monitor.lock());
+        WS->core.viewOffset = std::clamp(WS->core.viewOffset, 0.0, std::max(WS->maxWidth() - USABLE.w, 1.0));
     }
 }
 
@@ -524,6 +724,8 @@ void CScrollingLayout::recalculateMonitor(const MONITORID& id) {
     if (!DATA)
         return;
 
+    // reserved areas and the like, nothing our boxes would notice
+    DATA->invalidateApplied();
     DATA->recalculate();
 }
 
@@ -536,6 +738,10 @@ void CScrollingLayout::recalculateWindow(PHLWINDOW window) {
     if (!DATA)
         return;
 
+    // the window itself changed (pseudo, rules...), make sure it gets applied even if its box didn't
+    if (const auto WDATA = dataFor(window); WDATA)
+        WDATA->appliedBox.reset();
+
     DATA->recalculate();
 }
 
@@ -565,76 +771,22 @@ void CScrollingLayout::resizeActiveWindow(const Vector2D& delta, eRectCorner cor
     if (!DATA->column || !DATA->column->workspace || !DATA->column->workspace->workspace || !DATA->column->workspace->workspace->m_monitor)
         return;
 
-    const auto USABLE        = usableAreaFor(DATA->column->workspace->workspace->m_monitor.lock());
-    const auto DELTA_AS_PERC = delta / USABLE.size();
-
-    const auto CURR_COLUMN = DATA->column.lock();
-    const auto NEXT_COLUMN = DATA->column->workspace->next(CURR_COLUMN);
-    const auto PREV_COLUMN = DATA->column->workspace->prev(CURR_COLUMN);
-
-    switch (corner) {
-        case CORNER_BOTTOMLEFT:
-        case CORNER_TOPLEFT: {
-            if (!PREV_COLUMN)
-                break;
-
-            PREV_COLUMN->columnWidth = std::clamp(PREV_COLUMN->columnWidth + (float)DELTA_AS_PERC.x, MIN_COLUMN_WIDTH, MAX_COLUMN_WIDTH);
-            CURR_COLUMN->columnWidth = std::clamp(CURR_COLUMN->columnWidth - (float)DELTA_AS_PERC.x, MIN_COLUMN_WIDTH, MAX_COLUMN_WIDTH);
-            break;
-        }
-        case CORNER_BOTTOMRIGHT:
-        case CORNER_TOPRIGHT: {
-            if (!NEXT_COLUMN)
-                break;
-
-            NEXT_COLUMN->columnWidth = std::clamp(NEXT_COLUMN->columnWidth - (float)DELTA_AS_PERC.x, MIN_COLUMN_WIDTH, MAX_COLUMN_WIDTH);
-            CURR_COLUMN->columnWidth = std::clamp(CURR_COLUMN->columnWidth + (float)DELTA_AS_PERC.x, MIN_COLUMN_WIDTH, MAX_COLUMN_WIDTH);
-            break;
-        }
-
-        default: break;
-    }
-
-    if (DATA->column->windowDatas.size() > 1) {
-        const auto CURR_WD = DATA;
-        const auto NEXT_WD = DATA->column->next(DATA);
-        const auto PREV_WD = DATA->column->prev(DATA);
+    const auto WS     = DATA->column->workspace.lock();
+    const auto USABLE = usableAreaFor(WS->workspace->m_monitor.lock());
+    const auto COL    = WS->idx(DATA->column.lock());
+    const auto ROW    = DATA->column->row(DATA);
 
-        switch (corner) {
-            case CORNER_BOTTOMLEFT:
-            case CORNER_BOTTOMRIGHT: {
-                if (!NEXT_WD)
-                    break;
-
-                if (NEXT_WD->windowSize <= MIN_ROW_HEIGHT && delta.y >= 0)
-                    break;
-
-                float adjust = std::clamp((float)(delta.y / USABLE.h), (-CURR_WD->windowSize + MIN_ROW_HEIGHT), (NEXT_WD->windowSize - MIN_ROW_HEIGHT));
-
-                NEXT_WD->windowSize = std::clamp(NEXT_WD->windowSize - adjust, MIN_ROW_HEIGHT, MAX_ROW_HEIGHT);
-                CURR_WD->windowSize = std::clamp(CURR_WD->windowSize + adjust, MIN_ROW_HEIGHT, MAX_ROW_HEIGHT);
-                break;
-            }
-            case CORNER_TOPLEFT:
-            case CORNER_TOPRIGHT: {
-                if (!PREV_WD)
-                    break;
-
-                if (PREV_WD->windowSize <= MIN_ROW_HEIGHT && delta.y <= 0 || CURR_WD->windowSize <= MIN_ROW_HEIGHT && delta.y >= 0)
-                    break;
-
-                float adjust = std::clamp((float)(delta.y / USABLE.h), -(PREV_WD->windowSize - MIN_ROW_HEIGHT), (CURR_WD->windowSize - MIN_ROW_HEIGHT));
+    if (COL == -1 || ROW == -1)
+        return;
 
-                PREV_WD->windowSize = std::clamp(PREV_WD->windowSize + adjust, MIN_ROW_HEIGHT, MAX_ROW_HEIGHT);
-                CURR_WD->windowSize = std::clamp(CURR_WD->windowSize - adjust, MIN_ROW_HEIGHT, MAX_ROW_HEIGHT);
-                break;
-            }
+    const bool LEFT = corner == CORNER_TOPLEFT || corner == CORNER_BOTTOMLEFT;
+    const bool TOP  = corner == CORNER_TOPLEFT || corner == CORNER_TOPRIGHT;
 
-            default: break;
-        }
-    }
+    WS->core.resizeColumn(COL, LEFT, (float)(delta.x / USABLE.w));
+    WS->core.resizeRow(COL, ROW, TOP, (float)(delta.y / USABLE.h));
 
-    DATA->column->workspace->recalculate(true);
+    // pointer motion comes in way faster than we draw, only lay out once per frame
+    WS->scheduleRecalculate(true);
 }
 
 void CScrollingLayout::fullscreenRequestForWindow(PHLWINDOW pWindow, const eFullscreenMode CURRENT_EFFECTIVE_MODE, const eFullscreenMode EFFECTIVE_MODE) {
@@ -654,9 +806,10 @@ void CScrollingLayout::fullscreenRequestForWindow(PHLWINDOW pWindow, const eFull
     if (EFFECTIVE_MODE == FSMODE_NONE) {
         // if it got its fullscreen disabled, set back its node if it had one
 
-        if (PNODE)
+        if (PNODE) {
             applyNodeDataToWindow(PNODE, false);
-        else {
+            PNODE->appliedBox = PNODE->layoutBox;
+        } else {
             // get back its' dimensions from position and size
             *pWindow->m_realPosition = pWindow->m_lastFloatingPosition;
             *pWindow->m_realSize     = pWindow->m_lastFloatingSize;
@@ -711,14 +864,14 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
             const auto COL = DATA->next(WDATA->column.lock());
             if (!COL) {
                 // move to max
-                DATA->leftOffset = DATA->maxWidth();
-                DATA->recalculate();
+                DATA->core.viewOffset = DATA->maxWidth();
+                DATA->scheduleRecalculate();
                 g_pCompositor->focusWindow(nullptr);
                 return {};
             }
 
             centerOrFit(DATA, COL);
-            DATA->recalculate();
+            DATA->scheduleRecalculate();
 
             g_pCompositor->focusWindow(COL->windowDatas.front()->window.lock());
 
@@ -726,9 +879,9 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
         } else if (ARGS[1] == "-col") {
             const auto WDATA = dataFor(g_pCompositor->m_lastWindow.lock());
             if (!WDATA) {
-                if (DATA->leftOffset <= DATA->maxWidth() && DATA->columns.size() > 0) {
+                if (DATA->core.viewOffset <= DATA->maxWidth() && DATA->columns.size() > 0) {
                     DATA->centerCol(DATA->columns.back());
-                    DATA->recalculate();
+                    DATA->scheduleRecalculate();
                     g_pCompositor->focusWindow((DATA->columns.back()->windowDatas.back())->window.lock());
                 }
 
@@ -740,7 +893,7 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
                 return {};
 
             centerOrFit(DATA, COL);
-            DATA->recalculate();
+            DATA->scheduleRecalculate();
 
             g_pCompositor->focusWindow(COL->windowDatas.back()->window.lock());
 
@@ -752,8 +905,8 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
         if (!PLUSMINUS.has_value())
             return {};
 
-        DATA->leftOffset -= *PLUSMINUS;
-        DATA->recalculate();
+        DATA->core.viewOffset -= *PLUSMINUS;
+        DATA->scheduleRecalculate();
 
         const auto ATCENTER = DATA->atCenter();
 
@@ -771,46 +924,23 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
             } catch (...) { return {}; }
 
             for (const auto& c : WDATA->column->workspace->columns) {
-                c->columnWidth = abs;
+                c->setWidth(abs);
             }
 
-            WDATA->column->workspace->recalculate();
+            WDATA->column->workspace->scheduleRecalculate();
             return {};
         }
 
         CScopeGuard x([WDATA] {
-            WDATA->column->columnWidth = std::clamp(WDATA->column->columnWidth, MIN_COLUMN_WIDTH, MAX_COLUMN_WIDTH);
+            WDATA->column->setWidth(std::clamp(WDATA->column->width(), MIN_COLUMN_WIDTH, MAX_COLUMN_WIDTH));
             WDATA->column->workspace->fitCol(WDATA->column.lock());
-            WDATA->column->workspace->recalculate();
+            WDATA->column->workspace->scheduleRecalculate();
         });
 
         if (ARGS[1][0] == '+' || ARGS[1][0] == '-') {
-            if (ARGS[1] == "+conf") {
-                for (size_t i = 0; i < m_config.configuredWidths.size(); ++i) {
-                    if (m_config.configuredWidths[i] < WDATA->column->columnWidth)
-                        continue;
-
-                    if (i == m_config.configuredWidths.size() - 1)
-                        WDATA->column->columnWidth = m_config.configuredWidths[0];
-                    else
-                        WDATA->column->columnWidth = m_config.configuredWidths[i + 1];
-
-                    break;
-                }
-
-                return {};
-            } else if (ARGS[1] == "-conf") {
-                for (size_t i = m_config.configuredWidths.size() - 1; i >= 0; --i) {
-                    if (m_config.configuredWidths[i] > WDATA->column->columnWidth)
-                        continue;
-
-                    if (i == 0)
-                        WDATA->column->columnWidth = m_config.configuredWidths[m_config.configuredWidths.size() - 1];
-                    else
-                        WDATA->column->columnWidth = m_config.configuredWidths[i - 1];
-
-                    break;
-                }
+            if (ARGS[1] == "+conf" || ARGS[1] == "-conf") {
+                if (const auto WIDTH = cycleColumnWidth(m_config.configuredWidths, WDATA->column->width(), ARGS[1] == "+conf"); WIDTH)
+                    WDATA->column->setWidth(*WIDTH);
 
                 return {};
             }
@@ -820,14 +950,14 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
             if (!PLUSMINUS.has_value())
                 return {};
 
-            WDATA->column->columnWidth += *PLUSMINUS;
+            WDATA->column->setWidth(WDATA->column->width() + *PLUSMINUS);
         } else {
             float abs = 0;
             try {
                 abs = std::stof(ARGS[1]);
             } catch (...) { return {}; }
 
-            WDATA->column->columnWidth = abs;
+            WDATA->column->setWidth(abs);
         }
     } else if (ARGS[0] == "movewindowto") {
         moveWindowTo(g_pCompositor->m_lastWindow.lock(), ARGS[1], false);
@@ -841,19 +971,9 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
             if (!WDATA || !WORKDATA || WORKDATA->columns.size() == 0)
                 return {};
 
-            const auto USABLE = usableAreaFor(WORKDATA->workspace->m_monitor.lock());
-
-            WDATA->column->columnWidth = 1.F;
+            WORKDATA->core.fitActive(std::max(WORKDATA->idx(WDATA->column.lock()), (int64_t)0), WORKDATA->usableWidth());
 
-            WORKDATA->leftOffset = 0;
-            for (size_t i = 0; i < WORKDATA->columns.size(); ++i) {
-                if (WORKDATA->columns[i]->has(g_pCompositor->m_lastWindow.lock()))
-                    break;
-
-                WORKDATA->leftOffset += USABLE.w * WORKDATA->columns[i]->columnWidth;
-            }
-
-            WDATA->column->workspace->recalculate();
+            WDATA->column->workspace->scheduleRecalculate();
         } else if (ARGS[1] == "all") {
             // fit all columns on screen
             const auto WDATA = dataFor(g_pCompositor->m_lastWindow->m_workspace);
@@ -861,12 +981,9 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
             if (!WDATA || WDATA->columns.size() == 0)
                 return {};
 
-            const size_t LEN = WDATA->columns.size();
-            for (const auto& c : WDATA->columns) {
-                c->columnWidth = 1.F / (float)LEN;
-            }
+            WDATA->core.fitAll();
 
-            WDATA->recalculate();
+            WDATA->scheduleRecalculate();
         } else if (ARGS[1] == "toend") {
             // fit all columns on screen that start from the current and end on the last
             const auto WDATA = dataFor(g_pCompositor->m_lastWindow->m_workspace);
@@ -874,31 +991,14 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
             if (!WDATA || WDATA->columns.size() == 0)
                 return {};
 
-            bool   begun   = false;
-            size_t foundAt = 0;
-            for (size_t i = 0; i < WDATA->columns.size(); ++i) {
-                if (!begun && !WDATA->columns[i]->has(g_pCompositor->m_lastWindow.lock()))
-                    continue;
+            const auto COL = std::ranges::find_if(WDATA->columns, [](const auto& c) { return c->has(g_pCompositor->m_lastWindow.lock()); });
 
-                if (!begun) {
-                    begun   = true;
-                    foundAt = i;
-                }
-
-                WDATA->columns[i]->columnWidth = 1.F / (float)(WDATA->columns.size() - i);
-            }
-
-            if (!begun)
+            if (COL == WDATA->columns.end())
                 return {};
 
-            const auto USABLE = usableAreaFor(WDATA->workspace->m_monitor.lock());
+            WDATA->core.fitToEnd(COL - WDATA->columns.begin(), WDATA->usableWidth());
 
-            WDATA->leftOffset = 0;
-            for (size_t i = 0; i < foundAt; ++i) {
-                WDATA->leftOffset += USABLE.w * WDATA->columns[i]->columnWidth;
-            }
-
-            WDATA->recalculate();
+            WDATA->scheduleRecalculate();
         } else if (ARGS[1] == "tobeg") {
             // fit all columns on screen that start from the current and end on the last
             const auto WDATA = dataFor(g_pCompositor->m_lastWindow->m_workspace);
@@ -906,26 +1006,14 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
             if (!WDATA || WDATA->columns.size() == 0)
                 return {};
 
-            bool   begun   = false;
-            size_t foundAt = 0;
-            for (int64_t i = (int64_t)WDATA->columns.size() - 1; i >= 0; --i) {
-                if (!begun && !WDATA->columns[i]->has(g_pCompositor->m_lastWindow.lock()))
-                    continue;
-
-                if (!begun) {
-                    begun   = true;
-                    foundAt = i;
-                }
+            const auto COL = std::ranges::find_if(WDATA->columns, [](const auto& c) { return c->has(g_pCompositor->m_lastWindow.lock()); });
 
-                WDATA->columns[i]->columnWidth = 1.F / (float)(foundAt + 1);
-            }
-
-            if (!begun)
+            if (COL == WDATA->columns.end())
                 return {};
 
-            WDATA->leftOffset = 0;
+            WDATA->core.fitToBeginning(COL - WDATA->columns.begin());
 
-            WDATA->recalculate();
+            WDATA->scheduleRecalculate();
         } else if (ARGS[1] == "visible") {
             // fit all columns on screen that start from the current and end on the last
             const auto WDATA = dataFor(g_pCompositor->m_lastWindow->m_workspace);
@@ -933,42 +1021,10 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
             if (!WDATA || WDATA->columns.size() == 0)
                 return {};
 
-            bool                         begun   = false;
-            size_t                       foundAt = 0;
-            std::vector<SP<SColumnData>> visible;
-            for (size_t i = 0; i < WDATA->columns.size(); ++i) {
-                if (!begun && !WDATA->visible(WDATA->columns[i]))
-                    continue;
-
-                if (!begun) {
-                    begun   = true;
-                    foundAt = i;
-                }
-
-                if (!WDATA->visible(WDATA->columns[i]))
-                    break;
-
-                visible.emplace_back(WDATA->columns[i]);
-            }
-
-            if (!begun)
+            if (!WDATA->core.fitVisible(WDATA->usableWidth()))
                 return {};
 
-            WDATA->leftOffset = 0;
-
-            if (foundAt != 0) {
-                const auto USABLE = usableAreaFor(WDATA->workspace->m_monitor.lock());
-
-                for (size_t i = 0; i < foundAt; ++i) {
-                    WDATA->leftOffset += USABLE.w * WDATA->columns[i]->columnWidth;
-                }
-            }
-
-            for (const auto& v : visible) {
-                v->columnWidth = 1.F / (float)visible.size();
-            }
-
-            WDATA->recalculate();
+            WDATA->scheduleRecalculate();
         }
     } else if (ARGS[0] == "focus") {
         const auto WDATA = dataFor(g_pCompositor->m_lastWindow.lock());
@@ -1004,7 +1060,7 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
 
                 g_pCompositor->focusWindow(PREV->windowDatas.front()->window.lock());
                 centerOrFit(WDATA->column->workspace.lock(), PREV);
-                WDATA->column->workspace->recalculate();
+                WDATA->column->workspace->scheduleRecalculate();
                 break;
             }
 
@@ -1015,7 +1071,7 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
 
                 g_pCompositor->focusWindow(NEXT->windowDatas.front()->window.lock());
                 centerOrFit(WDATA->column->workspace.lock(), NEXT);
-                WDATA->column->workspace->recalculate();
+                WDATA->column->workspace->scheduleRecalculate();
                 break;
             }
 
@@ -1027,14 +1083,10 @@ std::any CScrollingLayout::layoutMessage(SLayoutMessageHeader header, std::strin
         if (!WDATA)
             return {};
 
-        auto idx = WDATA->column->workspace->idx(WDATA->column.lock());
-        auto col = idx == -1 ? WDATA->column->workspace->add() : WDATA->column->workspace->add(idx);
-
-        WDATA->column->remove(WDATA->window.lock());
+        const auto WS = WDATA->column->workspace.lock();
 
-        col->add(WDATA);
-
-        WDATA->column->workspace->recalculate();
+        WS->promote(WDATA);
+        WS->scheduleRecalculate();
     }
 
     return {};
@@ -1100,39 +1152,105 @@ void CScrollingLayout::replaceWindowDataWith(PHLWINDOW from, PHLWINDOW to) {
 }
 
 Vector2D CScrollingLayout::predictSizeForNewWindowTiled() {
-    return Vector2D{};
+    static const auto PCOLWIDTH    = CConfigValue<Hyprlang::FLOAT>("plugin:hyprscrolling:column_width");
+    static const auto PFSONONE     = CConfigValue<Hyprlang::INT>("plugin:hyprscrolling:fullscreen_on_one_column");
+    static auto       PBORDERSIZE  = CConfigValue<Hyprlang::INT>("general:border_size");
+
+    const auto        PMONITOR = g_pCompositor->m_lastMonitor.lock();
+
+    if (!PMONITOR || !PMONITOR->m_activeWorkspace)
+        return Vector2D{};
+
+    // onWindowCreatedTiling always gives a new window a fresh full-height column of column_width,
+    // unless it's the only column and that one goes fullscreen
+    const auto   DATA   = dataFor(PMONITOR->m_activeWorkspace);
+    const auto   USABLE = usableAreaFor(PMONITOR);
+    const bool   ALONE  = !DATA || DATA->columns.empty();
+    const double WIDTH  = *PFSONONE && ALONE ? USABLE.w : USABLE.w * *PCOLWIDTH;
+
+    // same gaps applyNodeDataToWindow will use: outer ones on the edges the column touches. fitCol usually
+    // leaves a new column against one screen edge, but which one isn't known yet, so only full-width ones get outer gaps on both sides.
+    const auto   RULES     = rulesFor(PMONITOR->m_activeWorkspace);
+    const auto&  GAPSIN    = RULES.gapsIn;
+    const auto&  GAPSOUT   = RULES.gapsOut;
+    const bool   FULLWIDTH = WIDTH >= USABLE.w - 1;
+
+    const double HORIZONTAL = FULLWIDTH ? GAPSOUT.m_left + GAPSOUT.m_right : GAPSIN.m_left + GAPSIN.m_right;
+    const double VERTICAL   = GAPSOUT.m_top + GAPSOUT.m_bottom;
+    const double BORDERS    = 2.0 * *PBORDERSIZE;
+
+    return Vector2D{std::max(WIDTH - HORIZONTAL - BORDERS, 1.0), std::max(USABLE.h - VERTICAL - BORDERS, 1.0)};
 }
 
 SP<SWorkspaceData> CScrollingLayout::dataFor(PHLWORKSPACE ws) {
-    for (const auto& e : m_workspaceDatas) {
-        if (e->workspace != ws)
-            continue;
+    if (!ws)
+        return nullptr;
 
-        return e;
-    }
+    const auto IT = m_workspaceIndex.find(ws.get());
+    if (IT == m_workspaceIndex.end())
+        return nullptr;
+
+    const auto DATA = IT->second.lock();
+
+    // the workspace this was made for is gone and something else got its address
+    if (!DATA || DATA->workspace != ws)
+        return nullptr;
 
-    return nullptr;
+    return DATA;
 }
 
 SP<SScrollingWindowData> CScrollingLayout::dataFor(PHLWINDOW w) {
     if (!w)
         return nullptr;
 
-    for (const auto& e : m_workspaceDatas) {
-        if (e->workspace != w->m_workspace)
-            continue;
+    SP<SScrollingWindowData> data;
+
+    if (const auto IT = m_windowIndex.find(w.get()); IT != m_windowIndex.end())
+        data = IT->second.lock();
+
+    // only nodes on the window's current workspace count, same as looking it up column by column
+    if (data && (data->window != w || !data->column || !data->column->workspace || data->column->workspace->workspace != w->m_workspace))
+        data = nullptr;
 
-        for (const auto& c : e->columns) {
-            for (const auto& d : c->windowDatas) {
-                if (d->window != w)
-                    continue;
+#ifndef NDEBUG
+    verifyIndex(w, data);
+#endif
+
+    return data;
+}
+
+void CScrollingLayout::indexWindow(SP<SScrollingWindowData> data) {
+    if (const auto PWINDOW = data->window.lock(); PWINDOW)
+        m_windowIndex[PWINDOW.get()] = data;
+}
 
-                return d;
+void CScrollingLayout::unindexWindow(PHLWINDOW w) {
+    if (w)
+        m_windowIndex.erase(w.get());
+}
+
+void CScrollingLayout::verifyIndex(PHLWINDOW w, SP<SScrollingWindowData> indexed) {
+    // the first match, like the scan dataFor() used to do
+    const auto SCAN = [this, &w]() -> SP<SScrollingWindowData> {
+        for (const auto& e : m_workspaceDatas) {
+            if (e->workspace != w->m_workspace)
+                continue;
+
+            for (const auto& c : e->columns) {
+                for (const auto& d : c->windowDatas) {
+                    if (d->window == w)
+                        return d;
+                }
             }
         }
-    }
 
-    return nullptr;
+        return nullptr;
+    };
+
+    const auto SCANNED = SCAN();
+
+    if (SCANNED != indexed)
+        Debug::log(ERR, "[scroller] window index out of sync for {}: indexed {:x}, scanned {:x}", w, (uintptr_t)indexed.get(), (uintptr_t)SCANNED.get());
 }
 
 SP<SWorkspaceData> CScrollingLayout::currentWorkspaceData() {
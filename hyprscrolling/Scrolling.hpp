@@ -1,7 +1,11 @@
 #pragma once
 
+#include <optional>
+#include <unordered_map>
 #include <vector>
 #include <hyprland/src/layout/IHyprLayout.hpp>
+#include <hyprland/src/config/ConfigDataValues.hpp>
+#include "ScrollingCore.hpp"
 #include <hyprland/src/helpers/memory/Memory.hpp>
 #include <hyprland/src/managers/HookSystemManager.hpp>
 
@@ -9,18 +13,29 @@ class CScrollingLayout;
 struct SColumnData;
 struct SWorkspaceData;
 
+// what applying a node needs from the config for its workspace, resolved once instead of per window
+struct SWorkspaceRules {
+    CCssGapData gapsIn;
+    CCssGapData gapsOut;
+
+    bool        operator==(const SWorkspaceRules& other) const;
+};
+
 struct SScrollingWindowData {
-    SScrollingWindowData(PHLWINDOW w, SP<SColumnData> col, float ws = 1.F) : window(w), column(col), windowSize(ws) {
+    SScrollingWindowData(PHLWINDOW w, SP<SColumnData> col) : window(w), column(col) {
         ;
     }
 
     PHLWINDOWREF    window;
     WP<SColumnData> column;
-    float           windowSize             = 1.F;
     bool            ignoreFullscreenChecks = false;
     PHLWORKSPACEREF overrideWorkspace;
 
-    CBox            layoutBox;
+    CBox                layoutBox;
+    // layoutBox as of the last time it was applied to the window, unset forces the next recalculate to apply it
+    std::optional<CBox> appliedBox;
+    // the column was entirely outside the viewport and its margin at the last recalculate
+    bool                offscreen = false;
 };
 
 struct SColumnData {
@@ -38,12 +53,19 @@ struct SColumnData {
 
     SP<SScrollingWindowData>              next(SP<SScrollingWindowData> w);
     SP<SScrollingWindowData>              prev(SP<SScrollingWindowData> w);
+    // position in windowDatas, -1 if it's not in this column
+    int64_t                               row(SP<SScrollingWindowData> w);
+
+    // the width lives in the workspace's layout core
+    float                                 width();
+    void                                  setWidth(float width);
 
     std::vector<SP<SScrollingWindowData>> windowDatas;
-    float                                 columnSize  = 1.F;
-    float                                 columnWidth = 1.F;
     WP<SWorkspaceData>                    workspace;
 
+    // position in workspace->columns and its layout core
+    size_t                                index = 0;
+
     WP<SColumnData>                       self;
 };
 
@@ -54,13 +76,17 @@ struct SWorkspaceData {
 
     PHLWORKSPACEREF              workspace;
     std::vector<SP<SColumnData>> columns;
-    int                          leftOffset = 0;
+
+    // sizes and the view offset. Columns and their windows are kept in the same order as in here,
+    // only add and remove them through the functions below.
+    CScrollingCore               core;
 
     SP<SColumnData>              add();
     SP<SColumnData>              add(size_t after);
     int64_t                      idx(SP<SColumnData> c);
     void                         remove(SP<SColumnData> c);
     double                       maxWidth();
+    double                       usableWidth();
     SP<SColumnData>              next(SP<SColumnData> c);
     SP<SColumnData>              prev(SP<SColumnData> c);
     SP<SColumnData>              atCenter();
@@ -69,10 +95,41 @@ struct SWorkspaceData {
     void                         centerCol(SP<SColumnData> c);
     void                         fitCol(SP<SColumnData> c);
 
+    // moves a window into a new column right after its own, returns that column
+    SP<SColumnData>              promote(SP<SScrollingWindowData> w);
+
     void                         recalculate(bool forceInstant = false);
+    // recalculates on the next frame of the workspace's monitor, repeated calls before that collapse into one
+    void                         scheduleRecalculate(bool forceInstant = false);
+    // makes the next recalculate apply every window, for changes that don't show up in the layout boxes
+    void                         invalidateApplied();
+
+    // re-applies suspension for all windows without laying anything out
+    void                         updateSuspended();
+
+    struct {
+        size_t applied   = 0;
+        size_t panned    = 0;
+        size_t skipped   = 0;
+        size_t offscreen = 0;
+    } lastRecalc;
+
+    struct {
+        bool scheduled = false;
+        bool instant   = false;
+    } pendingRecalc;
 
     CScrollingLayout*            layout = nullptr;
     WP<SWorkspaceData>           self;
+
+  private:
+    // sets the index of every column from the given one on
+    void                         reindex(size_t from = 0);
+    // logs if the columns and windows don't have the core's shape anymore
+    void                         verifyCore();
+
+    // what the last recalculate applied with, a different set means every window has to be applied again
+    std::optional<SWorkspaceRules> lastRules;
 };
 
 class CScrollingLayout : public IHyprLayout {
@@ -102,17 +159,43 @@ class CScrollingLayout : public IHyprLayout {
   private:
     std::vector<SP<SWorkspaceData>> m_workspaceDatas;
 
+    // windows fully applied, only moved with the camera, or skipped because their box didn't change, across all recalculates
+    struct {
+        size_t applied = 0;
+        size_t panned  = 0;
+        size_t skipped = 0;
+    } m_recalcStats;
+
     SP<HOOK_CALLBACK_FN>            m_configCallback;
+    SP<HOOK_CALLBACK_FN>            m_preRenderCallback;
+    SP<HOOK_CALLBACK_FN>            m_workspaceCallback;
+
+    bool                            m_suspendedStale = false;
 
     struct {
         std::vector<float> configuredWidths;
     } m_config;
 
-    SP<SWorkspaceData>       dataFor(PHLWORKSPACE ws);
-    SP<SScrollingWindowData> dataFor(PHLWINDOW w);
-    SP<SWorkspaceData>       currentWorkspaceData();
+    // lookup indices for dataFor(), the vectors above stay the source of truth.
+    // keyed by address, hits are checked against the live refs so a reused address can't match.
+    std::unordered_map<CWorkspace*, WP<SWorkspaceData>>    m_workspaceIndex;
+    std::unordered_map<CWindow*, WP<SScrollingWindowData>> m_windowIndex;
+
+    SP<SWorkspaceData>                                     dataFor(PHLWORKSPACE ws);
+    SP<SScrollingWindowData>                               dataFor(PHLWINDOW w);
+    SP<SWorkspaceData>                                     currentWorkspaceData();
+
+    void                                                   indexWindow(SP<SScrollingWindowData> data);
+    void                                                   unindexWindow(PHLWINDOW w);
+    void                                                   verifyIndex(PHLWINDOW w, SP<SScrollingWindowData> indexed);
 
-    void                     applyNodeDataToWindow(SP<SScrollingWindowData> node, bool instant);
+    void                                                   applyNodeDataToWindow(SP<SScrollingWindowData> node, bool instant, const SWorkspaceRules* rules = nullptr);
+    SWorkspaceRules                                        rulesFor(PHLWORKSPACE ws);
+    // moves a window that only slid sideways with the camera, false if it needs a full apply
+    bool                                                   panWindow(SP<SScrollingWindowData> node, bool instant);
+    // suspends offscreen windows if suspend_offscreen is set, otherwise defers to the compositor's visibility rule
+    void                                                   updateSuspended(SP<SScrollingWindowData> node);
 
     friend struct SWorkspaceData;
+    friend struct SColumnData;
 };
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include "ScrollingCore.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+size_t CScrollingCore::columns() const {
+    return m_columns.size();
+}
+
+size_t CScrollingCore::addColumn(float width) {
+    m_columns.emplace_back(SColumn{.width = width, .rows = {}});
+    m_stripDirty = true;
+    return m_columns.size() - 1;
+}
+
+size_t CScrollingCore::insertColumn(size_t after, float width) {
+    m_columns.insert(m_columns.begin() + after + 1, SColumn{.width = width, .rows = {}});
+    m_stripDirty = true;
+    return after + 1;
+}
+
+void CScrollingCore::removeColumn(size_t col) {
+    m_columns.erase(m_columns.begin() + col);
+    m_stripDirty = true;
+}
+
+float CScrollingCore::columnWidth(size_t col) const {
+    return m_columns[col].width;
+}
+
+void CScrollingCore::setColumnWidth(size_t col, float width) {
+    m_columns[col].width = width;
+    m_stripDirty         = true;
+}
+
+void CScrollingCore::setFullscreenOnOne(bool enabled) {
+    m_stripDirty      = m_stripDirty || enabled != m_fullscreenOnOne;
+    m_fullscreenOnOne = enabled;
+}
+
+size_t CScrollingCore::rows(size_t col) const {
+    return m_columns[col].rows.size();
+}
+
+float CScrollingCore::rowHeight(size_t col, size_t row) const {
+    return m_columns[col].rows[row];
+}
+
+size_t CScrollingCore::addRow(size_t col) {
+    auto&       rows  = m_columns[col].rows;
+    const float COUNT = rows.size();
+
+    for (auto& r : rows) {
+        r *= COUNT / (COUNT + 1);
+    }
+
+    rows.emplace_back(1.F / (COUNT + 1));
+    return rows.size() - 1;
+}
+
+void CScrollingCore::removeRow(size_t col, size_t row) {
+    auto& rows = m_columns[col].rows;
+    rows.erase(rows.begin() + row);
+
+    float newMaxSize = 0.F;
+    for (const auto& r : rows) {
+        newMaxSize += r;
+    }
+
+    for (auto& r : rows) {
+        r *= 1.F / newMaxSize;
+    }
+}
+
+bool CScrollingCore::moveRow(size_t col, size_t row, bool down) {
+    auto& rows = m_columns[col].rows;
+
+    if (down ? row + 1 >= rows.size() : row == 0)
+        return false;
+
+    std::swap(rows[row], rows[down ? row + 1 : row - 1]);
+    return true;
+}
+
+size_t CScrollingCore::promote(size_t col, size_t row, float width) {
+    const auto NEWCOL = insertColumn(col, width);
+    addRow(NEWCOL);
+    removeRow(col, row);
+
+    if (!m_columns[col].rows.empty())
+        return NEWCOL;
+
+    removeColumn(col);
+    return col;
+}
+
+void CScrollingCore::resizeColumn(size_t col, bool left, float delta) {
+    if (left ? col == 0 : col + 1 >= m_columns.size())
+        return;
+
+    // delta goes to the column left of the dragged edge
+    auto& grow   = m_columns[left ? col - 1 : col].width;
+    auto& shrink = m_columns[left ? col : col + 1].width;
+
+    std::tie(grow, shrink) = shiftColumnWidth(grow, shrink, delta);
+    m_stripDirty           = true;
+}
+
+void CScrollingCore::resizeRow(size_t col, size_t row, bool top, float delta) {
+    auto& rows = m_columns[col].rows;
+
+    if (top ? row == 0 : row + 1 >= rows.size())
+        return;
+
+    auto& grow   = rows[top ? row - 1 : row];
+    auto& shrink = rows[top ? row : row + 1];
+
+    // already as small as it gets and being pushed further
+    if (shrink <= MIN_ROW_HEIGHT && delta >= 0)
+        return;
+
+    if (top && grow <= MIN_ROW_HEIGHT && delta <= 0)
+        return;
+
+    std::tie(grow, shrink) = shiftRowHeight(grow, shrink, delta);
+}
+
+void CScrollingCore::fitActive(size_t col, double usableWidth) {
+    setColumnWidth(col, 1.F);
+    viewOffset = left(col, usableWidth);
+}
+
+void CScrollingCore::fitAll() {
+    for (auto& c : m_columns) {
+        c.width = 1.F / (float)m_columns.size();
+    }
+
+    m_stripDirty = true;
+}
+
+void CScrollingCore::fitToEnd(size_t col, double usableWidth) {
+    for (size_t i = col; i < m_columns.size(); ++i) {
+        m_columns[i].width = 1.F / (float)(m_columns.size() - i);
+    }
+
+    m_stripDirty = true;
+    viewOffset   = left(col, usableWidth);
+}
+
+void CScrollingCore::fitToBeginning(size_t col) {
+    for (size_t i = 0; i <= col; ++i) {
+        m_columns[i].width = 1.F / (float)(col + 1);
+    }
+
+    m_stripDirty = true;
+    viewOffset   = 0;
+}
+
+bool CScrollingCore::fitVisible(double usableWidth) {
+    size_t first = 0;
+    while (first < m_columns.size() && !isVisible(first, usableWidth)) {
+        first++;
+    }
+
+    if (first == m_columns.size())
+        return false;
+
+    size_t end = first;
+    while (end < m_columns.size() && isVisible(end, usableWidth)) {
+        end++;
+    }
+
+    viewOffset = left(first, usableWidth);
+
+    for (size_t i = first; i < end; ++i) {
+        m_columns[i].width = 1.F / (float)(end - first);
+    }
+
+    m_stripDirty = true;
+    return true;
+}
+
+const SColumnStrip& CScrollingCore::strip() const {
+    if (!m_stripDirty)
+        return m_strip;
+
+    const bool          FULLONE = m_fullscreenOnOne && m_columns.size() == 1;
+
+    std::vector<double> widths;
+    widths.reserve(m_columns.size());
+
+    for (const auto& c : m_columns) {
+        widths.emplace_back(FULLONE ? 1.0 : c.width);
+    }
+
+    m_strip.rebuild(widths);
+    m_stripDirty = false;
+
+    return m_strip;
+}
+
+double CScrollingCore::left(size_t col, double usableWidth) const {
+    return strip().left(col, usableWidth);
+}
+
+double CScrollingCore::width(size_t col, double usableWidth) const {
+    return strip().width(col, usableWidth);
+}
+
+double CScrollingCore::maxWidth(double usableWidth) const {
+    return strip().total(usableWidth);
+}
+
+size_t CScrollingCore::columnEndingAt(double x, double usableWidth) const {
+    return strip().columnEndingAt(x, usableWidth);
+}
+
+bool CScrollingCore::isVisible(size_t col, double usableWidth) const {
+    return strip().isVisible(col, viewOffset, usableWidth);
+}
+
+bool CScrollingCore::isOffscreen(size_t col, double cameraLeft, double usableWidth, double margin) const {
+    return strip().isOffscreen(col, cameraLeft, usableWidth, margin);
+}
+
+double CScrollingCore::camera(double usableWidth) const {
+    return cameraFor(viewOffset, maxWidth(usableWidth), usableWidth);
+}
+
+void CScrollingCore::clampView(double usableWidth) {
+    viewOffset = std::clamp(viewOffset, 0.0, maxWidth(usableWidth));
+}
+
+void CScrollingCore::centerOn(size_t col, double usableWidth) {
+    viewOffset = strip().centerOn(col, usableWidth);
+}
+
+void CScrollingCore::fitInto(size_t col, double usableWidth) {
+    viewOffset = strip().fitInto(col, viewOffset, usableWidth);
+}
+
+std::optional<float> cycleColumnWidth(const std::vector<float>& configured, float current, bool forward) {
+    if (configured.empty())
+        return std::nullopt;
+
+    if (forward) {
+        // the first one at least as wide, then the one after it
+        for (size_t i = 0; i < configured.size(); ++i) {
+            if (configured[i] < current)
+                continue;
+
+            return i == configured.size() - 1 ? configured.front() : configured[i + 1];
+        }
+
+        return std::nullopt;
+    }
+
+    // the last one at most as wide, then the one before it
+    for (size_t i = configured.size(); i > 0; --i) {
+        if (configured[i - 1] > current)
+            continue;
+
+        return i == 1 ? configured.back() : configured[i - 2];
+    }
+
+    return std::nullopt;
+}
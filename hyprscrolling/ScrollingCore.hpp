@@ -0,0 +1,84 @@
+#pragma once
+
+#include "ScrollingGeometry.hpp"
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+// One workspace of the scrolling layout as plain numbers: columns left to right with their width as a fraction of
+// the usable width, the rows of each column top to bottom with their height as a fraction of the usable height, and
+// how far the view is scrolled in layout px. SWorkspaceData keeps its columns and windows in the same order and takes
+// every size and position from here, nothing in here knows about the compositor.
+class CScrollingCore {
+  public:
+    size_t columns() const;
+    // appends a column, returns its index
+    size_t addColumn(float width);
+    // inserts a column right after the given one, returns its index
+    size_t insertColumn(size_t after, float width);
+    void   removeColumn(size_t col);
+    float  columnWidth(size_t col) const;
+    void   setColumnWidth(size_t col, float width);
+    // a column that's alone takes the full width, whatever its own is
+    void   setFullscreenOnOne(bool enabled);
+
+    // the rows of a column always add up to 1
+    size_t rows(size_t col) const;
+    float  rowHeight(size_t col, size_t row) const;
+    // appends a row, the others shrink evenly to make room. Returns its index.
+    size_t addRow(size_t col);
+    // the others grow back to fill the column, an emptied column stays until it's removed
+    void   removeRow(size_t col, size_t row);
+    // swaps a row with the one above or below it, false if there is none
+    bool   moveRow(size_t col, size_t row, bool down);
+    // moves a row into a new column right after its own, which goes away if that leaves it empty.
+    // Returns the new column's index.
+    size_t promote(size_t col, size_t row, float width);
+
+    // resizing from a window's corner: width moves between the column and its neighbour on that side,
+    // height between the row and the one above or below it
+    void   resizeColumn(size_t col, bool left, float delta);
+    void   resizeRow(size_t col, size_t row, bool top, float delta);
+
+    // the fit layout messages
+    void   fitActive(size_t col, double usableWidth);
+    void   fitAll();
+    void   fitToEnd(size_t col, double usableWidth);
+    void   fitToBeginning(size_t col);
+    // false if no column is visible
+    bool   fitVisible(double usableWidth);
+
+    double viewOffset = 0.0;
+
+    double left(size_t col, double usableWidth) const;
+    double width(size_t col, double usableWidth) const;
+    double maxWidth(double usableWidth) const;
+    // first column whose right edge is at or past x, columns() if there is none
+    size_t columnEndingAt(double x, double usableWidth) const;
+    bool   isVisible(size_t col, double usableWidth) const;
+    bool   isOffscreen(size_t col, double cameraLeft, double usableWidth, double margin) const;
+    // where the strip is drawn from, see cameraFor()
+    double camera(double usableWidth) const;
+
+    void   clampView(double usableWidth);
+    void   centerOn(size_t col, double usableWidth);
+    void   fitInto(size_t col, double usableWidth);
+
+  private:
+    struct SColumn {
+        float              width = 1.F;
+        std::vector<float> rows;
+    };
+
+    std::vector<SColumn> m_columns;
+    bool                 m_fullscreenOnOne = false;
+
+    // offsets only change with the columns, rebuilt lazily so a message touching many of them pays for one pass
+    const SColumnStrip&  strip() const;
+    mutable SColumnStrip m_strip;
+    mutable bool         m_stripDirty = true;
+};
+
+// the width after current when cycling through the configured ones with colresize +conf or -conf, nothing if
+// current is past all of them
+std::optional<float> cycleColumnWidth(const std::vector<float>& configured, float current, bool forward);
@@ -0,0 +1,75 @@
+#include "ScrollingGeometry.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+void SColumnStrip::rebuild(const std::vector<double>& widths) {
+    offsets.resize(widths.size() + 1);
+    offsets[0] = 0.0;
+
+    for (size_t i = 0; i < widths.size(); ++i) {
+        offsets[i + 1] = offsets[i] + widths[i];
+    }
+}
+
+size_t SColumnStrip::size() const {
+    return offsets.size() - 1;
+}
+
+double SColumnStrip::left(size_t i, double usableWidth) const {
+    return offsets[i] * usableWidth;
+}
+
+double SColumnStrip::width(size_t i, double usableWidth) const {
+    return (offsets[i + 1] - offsets[i]) * usableWidth;
+}
+
+double SColumnStrip::total(double usableWidth) const {
+    return offsets.back() * usableWidth;
+}
+
+size_t SColumnStrip::columnEndingAt(double x, double usableWidth) const {
+    if (size() == 0 || usableWidth <= 0)
+        return size();
+
+    const auto IT = std::lower_bound(offsets.begin() + 1, offsets.end(), x / usableWidth);
+    return IT - offsets.begin() - 1;
+}
+
+double SColumnStrip::centerOn(size_t i, double usableWidth) const {
+    return left(i, usableWidth) - (usableWidth - width(i, usableWidth)) / 2.F;
+}
+
+double SColumnStrip::fitInto(size_t i, double viewOffset, double usableWidth) const {
+    const double LEFT = left(i, usableWidth);
+    return std::clamp(viewOffset, LEFT - usableWidth + width(i, usableWidth), LEFT);
+}
+
+bool SColumnStrip::isVisible(size_t i, double viewOffset, double usableWidth) const {
+    const double LEFT  = left(i, usableWidth);
+    const double RIGHT = LEFT + width(i, usableWidth);
+
+    return (LEFT >= viewOffset && LEFT < viewOffset + usableWidth) || (RIGHT >= viewOffset && RIGHT < viewOffset + usableWidth);
+}
+
+bool SColumnStrip::isOffscreen(size_t i, double cameraLeft, double usableWidth, double margin) const {
+    const double SCREENLEFT = left(i, usableWidth) - cameraLeft;
+    return SCREENLEFT + width(i, usableWidth) < -margin || SCREENLEFT > usableWidth + margin;
+}
+
+double cameraFor(double viewOffset, double stripWidth, double usableWidth) {
+    return stripWidth < usableWidth ? std::round((stripWidth - usableWidth) / 2.0) : viewOffset;
+}
+
+std::pair<float, float> shiftColumnWidth(float grow, float shrink, float delta) {
+    return {std::clamp(grow + delta, MIN_COLUMN_WIDTH, MAX_COLUMN_WIDTH), std::clamp(shrink - delta, MIN_COLUMN_WIDTH, MAX_COLUMN_WIDTH)};
+}
+
+std::pair<float, float> shiftRowHeight(float grow, float shrink, float delta) {
+    const float ADJUST = std::clamp(delta, -(grow - MIN_ROW_HEIGHT), shrink - MIN_ROW_HEIGHT);
+    return {std::clamp(grow + ADJUST, MIN_ROW_HEIGHT, MAX_ROW_HEIGHT), std::clamp(shrink - ADJUST, MIN_ROW_HEIGHT, MAX_ROW_HEIGHT)};
+}
+
+CBox rowBox(double columnLeft, double columnWidth, double top, float rowHeight, double usableHeight) {
+    return CBox{columnLeft, top, columnWidth, rowHeight * usableHeight};
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <hyprutils/math/Box.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using Hyprutils::Math::CBox;
+
+constexpr float MIN_COLUMN_WIDTH = 0.05F;
+constexpr float MAX_COLUMN_WIDTH = 1.F;
+constexpr float MIN_ROW_HEIGHT   = 0.1F;
+constexpr float MAX_ROW_HEIGHT   = 1.F;
+
+// The columns of a workspace laid out left to right as one long strip. Widths are fractions of the
+// usable width and positions come back in layout px. Only plain numbers go in and out, nothing in here
+// knows about monitors, windows or the config.
+struct SColumnStrip {
+    // offsets[i] is where column i starts, the last entry is where the strip ends
+    std::vector<double> offsets = {0.0};
+
+    void                rebuild(const std::vector<double>& widths);
+
+    size_t              size() const;
+    double              left(size_t i, double usableWidth) const;
+    double              width(size_t i, double usableWidth) const;
+    double              total(double usableWidth) const;
+
+    // first column whose right edge is at or past x, size() if the strip ends before that
+    size_t              columnEndingAt(double x, double usableWidth) const;
+
+    // view offsets that center column i, or move viewOffset just far enough for all of it to be visible
+    double              centerOn(size_t i, double usableWidth) const;
+    double              fitInto(size_t i, double viewOffset, double usableWidth) const;
+
+    // either edge inside the view
+    bool                isVisible(size_t i, double viewOffset, double usableWidth) const;
+    // entirely outside the view and margin px around it
+    bool                isOffscreen(size_t i, double cameraLeft, double usableWidth, double margin) const;
+};
+
+// where the strip is drawn from: the view offset, or centered when the whole strip fits
+double                  cameraFor(double viewOffset, double stripWidth, double usableWidth);
+
+// moves delta of the width from shrink to grow, each clamped on its own
+std::pair<float, float> shiftColumnWidth(float grow, float shrink, float delta);
+// moves delta of the height from shrink to grow, limited so neither drops below MIN_ROW_HEIGHT
+std::pair<float, float> shiftRowHeight(float grow, float shrink, float delta);
+
+// a window's box in a column, relative to the strip's origin
+CBox                    rowBox(double columnLeft, double columnWidth, double top, float rowHeight, double usableHeight);
@@ -0,0 +1,203 @@
+#include "../ScrollingCore.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Replays scripted layout messages against workspaces of 1k to 10k windows, with and without the layout pass a
+// recalculate does after each of them. Build with optimizations for meaningful numbers.
+
+static volatile double sink = 0;
+
+constexpr double       USABLE_W = 2560, USABLE_H = 1440, MARGIN = 200;
+constexpr float        COLUMN_WIDTH = 0.5F;
+
+// explicit_column_widths' default
+static const std::vector<float> CONFIGURED = {0.333F, 0.5F, 0.667F, 1.F};
+
+// the focused window, as the layout finds it from g_pCompositor->m_lastWindow
+struct SFocus {
+    size_t col = 0;
+    size_t row = 0;
+};
+
+static void clampFocus(const CScrollingCore& core, SFocus& focus) {
+    focus.col = std::min(focus.col, core.columns() - 1);
+    focus.row = std::min(focus.row, core.rows(focus.col) - 1);
+}
+
+// what CScrollingLayout::layoutMessage does with each message, minus focusing windows
+static void replay(CScrollingCore& core, SFocus& focus, std::string_view message) {
+    const auto        SPACE = message.find(' ');
+    const auto        VERB  = message.substr(0, SPACE);
+    const std::string ARG{SPACE == std::string_view::npos ? "" : message.substr(SPACE + 1)};
+
+    if (VERB == "focus") {
+        if (ARG == "r")
+            focus = {(focus.col + 1) % core.columns(), 0};
+        else if (ARG == "l")
+            focus = {focus.col == 0 ? core.columns() - 1 : focus.col - 1, 0};
+        else if (ARG == "d")
+            focus.row = (focus.row + 1) % core.rows(focus.col);
+
+        core.centerOn(focus.col, USABLE_W);
+    } else if (VERB == "move") {
+        if (ARG == "+col") {
+            if (focus.col + 1 < core.columns())
+                core.centerOn(++focus.col, USABLE_W);
+            else
+                core.viewOffset = core.maxWidth(USABLE_W);
+        } else if (ARG == "-col") {
+            if (focus.col > 0)
+                core.centerOn(--focus.col, USABLE_W);
+        } else {
+            core.viewOffset -= std::stod(ARG);
+            core.clampView(USABLE_W);
+            focus = {std::min(core.columnEndingAt(USABLE_W / 2.0 - 2 - core.viewOffset, USABLE_W), core.columns() - 1), 0};
+        }
+    } else if (VERB == "colresize") {
+        if (ARG == "+conf" || ARG == "-conf") {
+            if (const auto WIDTH = cycleColumnWidth(CONFIGURED, core.columnWidth(focus.col), ARG == "+conf"); WIDTH)
+                core.setColumnWidth(focus.col, *WIDTH);
+        } else
+            core.setColumnWidth(focus.col, core.columnWidth(focus.col) + std::stof(ARG));
+
+        core.setColumnWidth(focus.col, std::clamp(core.columnWidth(focus.col), MIN_COLUMN_WIDTH, MAX_COLUMN_WIDTH));
+        core.fitInto(focus.col, USABLE_W);
+    } else if (VERB == "fit") {
+        if (ARG == "active")
+            core.fitActive(focus.col, USABLE_W);
+        else if (ARG == "all")
+            core.fitAll();
+        else if (ARG == "toend")
+            core.fitToEnd(focus.col, USABLE_W);
+        else if (ARG == "tobeg")
+            core.fitToBeginning(focus.col);
+        else if (ARG == "visible")
+            core.fitVisible(USABLE_W);
+    } else if (VERB == "promote") {
+        focus = {core.promote(focus.col, focus.row, COLUMN_WIDTH), 0};
+    } else if (VERB == "movewindowto") {
+        if (ARG == "l" || ARG == "r") {
+            const bool LEFT = ARG == "l";
+            if (LEFT ? focus.col == 0 : focus.col + 1 >= core.columns())
+                return;
+
+            size_t target = LEFT ? focus.col - 1 : focus.col + 1;
+
+            core.removeRow(focus.col, focus.row);
+            if (core.rows(focus.col) == 0) {
+                core.removeColumn(focus.col);
+                target -= LEFT ? 0 : 1;
+            }
+
+            focus = {target, core.addRow(target)};
+            core.centerOn(focus.col, USABLE_W);
+        } else if (core.moveRow(focus.col, focus.row, ARG == "d"))
+            focus.row += ARG == "d" ? 1 : -1;
+    } else if (VERB == "resize") {
+        // a bottom right corner drag by this many px both ways
+        const float DELTA = std::stof(ARG);
+        core.resizeColumn(focus.col, false, DELTA / USABLE_W);
+        core.resizeRow(focus.col, focus.row, false, DELTA / USABLE_H);
+    }
+
+    core.clampView(USABLE_W);
+    clampFocus(core, focus);
+}
+
+// the geometry SWorkspaceData::recalculate works out for every window
+static void layout(const CScrollingCore& core) {
+    const double CAMERA = core.camera(USABLE_W);
+
+    for (size_t i = 0; i < core.columns(); ++i) {
+        const double LEFT      = core.left(i, USABLE_W) - CAMERA;
+        const double WIDTH     = core.width(i, USABLE_W);
+        const bool   OFFSCREEN = core.isOffscreen(i, CAMERA, USABLE_W, MARGIN);
+        double       top       = 0.0;
+
+        for (size_t j = 0; j < core.rows(i); ++j) {
+            const auto BOX = rowBox(LEFT, WIDTH, top, core.rowHeight(i, j), USABLE_H);
+            top += BOX.h;
+            sink = sink + BOX.x + OFFSCREEN;
+        }
+    }
+}
+
+static CScrollingCore workspaceWith(size_t windows, size_t perColumn) {
+    CScrollingCore core;
+
+    for (size_t i = 0; i < windows; ++i) {
+        if (i % perColumn == 0)
+            core.addColumn(COLUMN_WIDTH);
+
+        core.addRow(core.columns() - 1);
+    }
+
+    return core;
+}
+
+struct SScript {
+    const char*                   name;
+    std::vector<std::string_view> messages;
+};
+
+static const std::vector<SScript> SCRIPTS = {
+    {"navigate", {"focus r", "focus r", "move +col", "focus d", "move -200", "move +col", "move -col", "focus l", "move +400"}},
+    {"resize", {"colresize +0.1", "resize 40", "colresize +conf", "colresize -0.2", "resize -25", "colresize -conf", "move +col"}},
+    {"fit", {"fit visible", "move +col", "fit active", "fit toend", "move -col", "fit tobeg", "colresize 0.5", "fit all"}},
+    {"restructure", {"promote", "movewindowto l", "focus r", "movewindowto r", "movewindowto d", "promote", "movewindowto u", "focus r"}},
+};
+
+template <typename F>
+static double nsPerMessage(size_t messages, F&& fn) {
+    const auto BEGIN = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - BEGIN).count() / messages;
+}
+
+static void benchScript(const SScript& script, size_t windows, size_t perColumn) {
+    const size_t REPEATS  = 200;
+    const size_t MESSAGES = REPEATS * script.messages.size();
+
+    auto         core  = workspaceWith(windows, perColumn);
+    SFocus       focus = {core.columns() / 2, 0};
+
+    const double MESSAGE = nsPerMessage(MESSAGES, [&] {
+        for (size_t i = 0; i < REPEATS; ++i) {
+            for (const auto& m : script.messages) {
+                replay(core, focus, m);
+            }
+        }
+    });
+
+    core  = workspaceWith(windows, perColumn);
+    focus = {core.columns() / 2, 0};
+
+    const double WITHLAYOUT = nsPerMessage(MESSAGES, [&] {
+        for (size_t i = 0; i < REPEATS; ++i) {
+            for (const auto& m : script.messages) {
+                replay(core, focus, m);
+                layout(core);
+            }
+        }
+    });
+
+    std::printf("%-12s %7zu %5zu/col %14.1f %14.1f\n", script.name, windows, perColumn, MESSAGE, WITHLAYOUT);
+}
+
+int main() {
+    std::printf("%-12s %7s %9s %14s %14s\n", "script", "windows", "", "message ns", "+layout ns");
+
+    for (const auto& script : SCRIPTS) {
+        for (size_t windows : {1000, 2500, 5000, 10000}) {
+            benchScript(script, windows, 1);
+            benchScript(script, windows, 3);
+        }
+    }
+
+    return 0;
+}
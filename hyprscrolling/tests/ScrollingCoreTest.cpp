@@ -0,0 +1,232 @@
+#include "../ScrollingCore.hpp"
+#include "shared.hpp"
+
+int main() {
+    int ret = 0;
+
+    // rows share their column evenly as they come in and fill it back up as they leave
+    {
+        CScrollingCore core;
+        EXPECT(core.addColumn(0.5F), 0);
+        EXPECT(core.addRow(0), 0);
+        EXPECT_NEAR(core.rowHeight(0, 0), 1);
+        EXPECT(core.addRow(0), 1);
+        EXPECT(core.addRow(0), 2);
+        EXPECT(core.rows(0), 3);
+        EXPECT_NEAR(core.rowHeight(0, 0), 1.0 / 3.0);
+        EXPECT_NEAR(core.rowHeight(0, 2), 1.0 / 3.0);
+
+        core.resizeRow(0, 0, false, 0.2F);
+        EXPECT_NEAR(core.rowHeight(0, 0), 1.0 / 3.0 + 0.2);
+        EXPECT_NEAR(core.rowHeight(0, 1), 1.0 / 3.0 - 0.2);
+
+        core.removeRow(0, 2);
+        EXPECT(core.rows(0), 2);
+        EXPECT_NEAR(core.rowHeight(0, 0) + core.rowHeight(0, 1), 1);
+        EXPECT_NEAR(core.rowHeight(0, 0), (1.0 / 3.0 + 0.2) * 1.5);
+
+        // heights move with their rows
+        const float TOP = core.rowHeight(0, 0);
+        EXPECT(core.moveRow(0, 0, true), true);
+        EXPECT_NEAR(core.rowHeight(0, 1), TOP);
+        EXPECT(core.moveRow(0, 1, true), false);
+        EXPECT(core.moveRow(0, 0, false), false);
+    }
+
+    // row resizing stops at MIN_ROW_HEIGHT and only works between neighbours
+    {
+        CScrollingCore core;
+        core.addColumn(0.5F);
+        core.addRow(0);
+        core.addRow(0);
+
+        core.resizeRow(0, 0, false, 0.9F);
+        EXPECT_NEAR(core.rowHeight(0, 0), 1 - MIN_ROW_HEIGHT);
+        EXPECT_NEAR(core.rowHeight(0, 1), MIN_ROW_HEIGHT);
+
+        core.resizeRow(0, 0, false, 0.1F);
+        EXPECT_NEAR(core.rowHeight(0, 1), MIN_ROW_HEIGHT);
+
+        core.resizeRow(0, 1, true, -0.2F);
+        EXPECT_NEAR(core.rowHeight(0, 0), 1 - MIN_ROW_HEIGHT - 0.2);
+        EXPECT_NEAR(core.rowHeight(0, 1), MIN_ROW_HEIGHT + 0.2);
+
+        core.resizeRow(0, 0, true, 0.2F);
+        core.resizeRow(0, 1, false, 0.2F);
+        EXPECT_NEAR(core.rowHeight(0, 1), MIN_ROW_HEIGHT + 0.2);
+    }
+
+    // columns are laid out left to right in fractions of the usable width
+    {
+        CScrollingCore core;
+        core.addColumn(0.5F);
+        core.addColumn(0.25F);
+        EXPECT(core.insertColumn(0, 1.F), 1);
+        EXPECT(core.columns(), 3);
+        EXPECT_NEAR(core.columnWidth(1), 1);
+        EXPECT_NEAR(core.left(2, 1000), 1500);
+        EXPECT_NEAR(core.width(2, 1000), 250);
+        EXPECT_NEAR(core.maxWidth(1000), 1750);
+
+        core.removeColumn(1);
+        EXPECT_NEAR(core.left(1, 1000), 500);
+        EXPECT_NEAR(core.maxWidth(1000), 750);
+
+        EXPECT(core.columnEndingAt(499, 1000), 0);
+        EXPECT(core.columnEndingAt(501, 1000), 1);
+        EXPECT(core.columnEndingAt(751, 1000), 2);
+
+        // alone, it takes the whole width
+        core.removeColumn(1);
+        core.setFullscreenOnOne(true);
+        EXPECT_NEAR(core.maxWidth(1000), 1000);
+        core.setFullscreenOnOne(false);
+        EXPECT_NEAR(core.maxWidth(1000), 500);
+    }
+
+    // width moves to the column left of the dragged edge, each side clamped on its own
+    {
+        CScrollingCore core;
+        core.addColumn(0.5F);
+        core.addColumn(0.5F);
+
+        core.resizeColumn(0, false, 0.2F);
+        EXPECT_NEAR(core.columnWidth(0), 0.7);
+        EXPECT_NEAR(core.columnWidth(1), 0.3);
+
+        core.resizeColumn(1, true, -0.1F);
+        EXPECT_NEAR(core.columnWidth(0), 0.6);
+        EXPECT_NEAR(core.columnWidth(1), 0.4);
+
+        core.resizeColumn(0, false, 0.6F);
+        EXPECT_NEAR(core.columnWidth(0), MAX_COLUMN_WIDTH);
+        EXPECT_NEAR(core.columnWidth(1), MIN_COLUMN_WIDTH);
+
+        // nothing to trade with past the ends
+        core.resizeColumn(0, true, 0.1F);
+        core.resizeColumn(1, false, 0.1F);
+        EXPECT_NEAR(core.columnWidth(0), MAX_COLUMN_WIDTH);
+        EXPECT_NEAR(core.columnWidth(1), MIN_COLUMN_WIDTH);
+    }
+
+    // promote
+    {
+        CScrollingCore core;
+        core.addColumn(0.5F);
+        core.addColumn(0.5F);
+        core.addRow(0);
+        core.addRow(0);
+        core.addRow(1);
+
+        EXPECT(core.promote(0, 1, 0.25F), 1);
+        EXPECT(core.columns(), 3);
+        EXPECT(core.rows(0), 1);
+        EXPECT(core.rows(1), 1);
+        EXPECT(core.rows(2), 1);
+        EXPECT_NEAR(core.rowHeight(0, 0), 1);
+        EXPECT_NEAR(core.rowHeight(1, 0), 1);
+        EXPECT_NEAR(core.columnWidth(1), 0.25);
+
+        // a window alone in its column gets a new one in its place
+        EXPECT(core.promote(2, 0, 0.75F), 2);
+        EXPECT(core.columns(), 3);
+        EXPECT_NEAR(core.columnWidth(2), 0.75);
+    }
+
+    // the view
+    {
+        CScrollingCore core;
+        for (int i = 0; i < 4; ++i) {
+            core.addColumn(0.5F);
+        }
+
+        core.centerOn(2, 1000);
+        EXPECT_NEAR(core.viewOffset, 750);
+        EXPECT(core.isVisible(1, 1000), true);
+        EXPECT(core.isVisible(3, 1000), true);
+        EXPECT(core.isVisible(0, 1000), false);
+
+        core.fitInto(3, 1000);
+        EXPECT_NEAR(core.viewOffset, 1000);
+        core.fitInto(0, 1000);
+        EXPECT_NEAR(core.viewOffset, 0);
+        core.fitInto(1, 1000);
+        EXPECT_NEAR(core.viewOffset, 0);
+
+        core.viewOffset = 5000;
+        core.clampView(1000);
+        EXPECT_NEAR(core.viewOffset, 2000);
+        core.viewOffset = -10;
+        core.clampView(1000);
+        EXPECT_NEAR(core.viewOffset, 0);
+
+        EXPECT_NEAR(core.camera(1000), 0);
+        EXPECT(core.isOffscreen(3, 0, 1000, 200), true);
+        EXPECT(core.isOffscreen(2, 0, 1000, 200), false);
+
+        // narrower than the screen, so centered
+        CScrollingCore narrow;
+        narrow.addColumn(0.5F);
+        narrow.viewOffset = 100;
+        EXPECT_NEAR(narrow.camera(1000), -250);
+    }
+
+    // fit messages
+    {
+        CScrollingCore core;
+        for (int i = 0; i < 4; ++i) {
+            core.addColumn(0.5F);
+        }
+
+        core.fitToEnd(1, 1000);
+        EXPECT_NEAR(core.columnWidth(0), 0.5);
+        EXPECT_NEAR(core.columnWidth(1), 1.0 / 3.0);
+        EXPECT_NEAR(core.columnWidth(3), 1);
+        EXPECT_NEAR(core.viewOffset, 500);
+
+        core.fitToBeginning(2);
+        EXPECT_NEAR(core.columnWidth(0), 1.0 / 3.0);
+        EXPECT_NEAR(core.columnWidth(2), 1.0 / 3.0);
+        EXPECT_NEAR(core.columnWidth(3), 1);
+        EXPECT_NEAR(core.viewOffset, 0);
+
+        core.fitAll();
+        EXPECT_NEAR(core.columnWidth(3), 0.25);
+        EXPECT_NEAR(core.maxWidth(1000), 1000);
+
+        core.fitActive(2, 1000);
+        EXPECT_NEAR(core.columnWidth(2), 1);
+        EXPECT_NEAR(core.viewOffset, 500);
+
+        // 1 ends and 2 starts in view, 3 starts right where it ends
+        core.viewOffset = 400;
+        EXPECT(core.fitVisible(1000), true);
+        EXPECT_NEAR(core.viewOffset, 250);
+        EXPECT_NEAR(core.columnWidth(1), 0.5);
+        EXPECT_NEAR(core.columnWidth(2), 0.5);
+        EXPECT_NEAR(core.columnWidth(3), 0.25);
+
+        core.viewOffset = 0;
+        EXPECT(core.fitVisible(1000), true);
+        EXPECT_NEAR(core.columnWidth(0), 1.0 / 3.0);
+        EXPECT_NEAR(core.columnWidth(2), 1.0 / 3.0);
+        EXPECT_NEAR(core.columnWidth(3), 0.25);
+
+        EXPECT(CScrollingCore{}.fitVisible(1000), false);
+    }
+
+    // colresize +conf and -conf
+    {
+        const std::vector<float> CONF = {0.333F, 0.5F, 0.667F, 1.F};
+        EXPECT(cycleColumnWidth(CONF, 0.5F, true).value_or(-1), 0.667F);
+        EXPECT(cycleColumnWidth(CONF, 0.4F, true).value_or(-1), 0.667F);
+        EXPECT(cycleColumnWidth(CONF, 1.F, true).value_or(-1), 0.333F);
+        EXPECT(cycleColumnWidth(CONF, 0.5F, false).value_or(-1), 0.333F);
+        EXPECT(cycleColumnWidth(CONF, 0.333F, false).value_or(-1), 1.F);
+        EXPECT(cycleColumnWidth(CONF, 2.F, true).has_value(), false);
+        EXPECT(cycleColumnWidth(CONF, 0.1F, false).has_value(), false);
+        EXPECT(cycleColumnWidth({}, 0.5F, true).has_value(), false);
+    }
+
+    return ret;
+}
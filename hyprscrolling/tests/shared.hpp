@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cmath>
+#include <iostream>
+
+namespace Colors {
+    constexpr const char* RED   = "\x1b[31m";
+    constexpr const char* GREEN = "\x1b[32m";
+    constexpr const char* RESET = "\x1b[0m";
+};
+
+#define EXPECT(expr, val)                                                                                                                                                          \
+    if (const auto RESULT = expr; RESULT != (val)) {                                                                                                                               \
+        std::cout << Colors::RED << "Failed: " << Colors::RESET << #expr << ", expected " << (val) << " but got " << RESULT << "\n";                                               \
+        ret = 1;                                                                                                                                                                   \
+    } else {                                                                                                                                                                       \
+        std::cout << Colors::GREEN << "Passed " << Colors::RESET << #expr << ". Got " << (val) << "\n";                                                                            \
+    }
+
+// for anything that went through floating point math
+#define EXPECT_NEAR(expr, val)                                                                                                                                                     \
+    if (const double RESULT = expr; std::abs(RESULT - (val)) > 1e-4) {                                                                                                             \
+        std::cout << Colors::RED << "Failed: " << Colors::RESET << #expr << ", expected " << (val) << " but got " << RESULT << "\n";                                               \
+        ret = 1;                                                                                                                                                                   \
+    } else {                                                                                                                                                                       \
+        std::cout << Colors::GREEN << "Passed " << Colors::RESET << #expr << ". Got " << (val) << "\n";                                                                            \
+    }